@@ -0,0 +1,51 @@
+#include "Battle/BattleClock.h"
+
+namespace {
+// 单个渲染帧最多计入的时间（秒），超过的部分丢弃
+const float kMaxFrameDelta = 0.25f;
+}  // namespace
+
+BattleClock::BattleClock(int tickRate)
+    : _tickRate(tickRate > 0 ? tickRate : DEFAULT_TICK_RATE),
+      _tickDelta(1.0f / _tickRate),
+      _speed(1),
+      _tick(0),
+      _accumulator(0.0f) {}
+
+void BattleClock::beginFrame(float frameDelta) {
+  if (frameDelta <= 0.0f) {
+    return;
+  }
+  if (frameDelta > kMaxFrameDelta) {
+    frameDelta = kMaxFrameDelta;
+  }
+  _accumulator += frameDelta * _speed;
+}
+
+bool BattleClock::consumeTick() {
+  if (_accumulator < _tickDelta) {
+    return false;
+  }
+  _accumulator -= _tickDelta;
+  _tick++;
+  return true;
+}
+
+void BattleClock::setSpeed(int speed) {
+  switch (speed) {
+    case 1:
+    case 2:
+    case 4:
+    case 8:
+      _speed = speed;
+      break;
+    default:
+      _speed = 1;
+      break;
+  }
+}
+
+void BattleClock::reset() {
+  _tick = 0;
+  _accumulator = 0.0f;
+}
@@ -0,0 +1,78 @@
+#ifndef __BATTLE_CLOCK_H__
+#define __BATTLE_CLOCK_H__
+
+/**
+ * 战斗时钟
+ * 将渲染帧的可变时间间隔换算为固定步长的逻辑帧（tick），
+ * 使战斗结果与帧率无关。加速播放时每个渲染帧运行多个逻辑帧。
+ *
+ * 用法：
+ *   clock.beginFrame(dt);
+ *   while (clock.consumeTick()) { world.update(clock.getTickDelta()); }
+ *   float alpha = clock.getAlpha();  // 渲染插值系数
+ */
+class BattleClock {
+ public:
+  static const int DEFAULT_TICK_RATE = 30;  // 默认逻辑帧率（Hz）
+
+  /**
+   * 构造函数
+   * @param tickRate 逻辑帧率（每秒逻辑帧数）
+   */
+  explicit BattleClock(int tickRate = DEFAULT_TICK_RATE);
+
+  /**
+   * 开始一个渲染帧，累积待模拟的时间
+   * 单帧时间间隔会被截断，避免卡顿后一次性模拟过多逻辑帧
+   * @param frameDelta 渲染帧时间间隔（秒）
+   */
+  void beginFrame(float frameDelta);
+
+  /**
+   * 消耗一个逻辑帧
+   * @return 累积时间不足一个逻辑帧时返回 false
+   */
+  bool consumeTick();
+
+  /**
+   * 设置播放速度倍数（1、2、4、8），其它值按 1 处理
+   */
+  void setSpeed(int speed);
+  int getSpeed() const { return _speed; }
+
+  /**
+   * 重置为第 0 帧（保留逻辑帧率和速度）
+   */
+  void reset();
+
+  int getTickRate() const { return _tickRate; }
+
+  /**
+   * 每个逻辑帧的时间步长（秒）
+   */
+  float getTickDelta() const { return _tickDelta; }
+
+  /**
+   * 已完成的逻辑帧数
+   */
+  int getTick() const { return _tick; }
+
+  /**
+   * 已模拟的战斗时间（秒），由逻辑帧数换算，不受浮点累积误差影响
+   */
+  float getElapsed() const { return _tick * _tickDelta; }
+
+  /**
+   * 渲染插值系数 [0, 1)：剩余累积时间占一个逻辑帧的比例
+   */
+  float getAlpha() const { return _accumulator / _tickDelta; }
+
+ private:
+  int _tickRate;       // 逻辑帧率
+  float _tickDelta;    // 逻辑帧步长（秒）
+  int _speed;          // 播放速度倍数
+  int _tick;           // 已完成的逻辑帧数
+  float _accumulator;  // 尚未模拟的时间（秒）
+};
+
+#endif  // __BATTLE_CLOCK_H__
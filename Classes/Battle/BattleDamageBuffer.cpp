@@ -0,0 +1,36 @@
+#include "Battle/BattleDamageBuffer.h"
+
+#include <algorithm>
+
+void BattleDamageBuffer::drainBuildings(
+    std::vector<BattleDamageEvent>& totals) {
+  drain(_buildingEvents, totals);
+}
+
+void BattleDamageBuffer::drainSoldiers(std::vector<BattleDamageEvent>& totals) {
+  drain(_soldierEvents, totals);
+}
+
+void BattleDamageBuffer::clear() {
+  _buildingEvents.clear();
+  _soldierEvents.clear();
+}
+
+void BattleDamageBuffer::drain(std::vector<BattleDamageEvent>& events,
+                               std::vector<BattleDamageEvent>& totals) {
+  totals.clear();
+
+  // 稳定排序保持同一目标的事件顺序，浮点累加结果固定
+  std::stable_sort(events.begin(), events.end(),
+                   [](const BattleDamageEvent& a, const BattleDamageEvent& b) {
+                     return a.target < b.target;
+                   });
+  for (const BattleDamageEvent& event : events) {
+    if (!totals.empty() && totals.back().target == event.target) {
+      totals.back().amount += event.amount;
+    } else {
+      totals.push_back(event);
+    }
+  }
+  events.clear();
+}
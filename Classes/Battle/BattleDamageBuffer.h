@@ -0,0 +1,72 @@
+#ifndef __BATTLE_DAMAGE_BUFFER_H__
+#define __BATTLE_DAMAGE_BUFFER_H__
+
+#include <vector>
+
+#include "Battle/BattleMath.h"
+
+/**
+ * 一次伤害（或按目标汇总后的总伤害）
+ */
+struct BattleDamageEvent {
+  int target;         // 建筑 id 或士兵 id
+  BattleReal amount;  // 伤害值
+};
+
+/**
+ * 一个逻辑帧结算后发生的变化，供表现层只刷新变化的精灵
+ * 列表中的 id 按升序排列且不重复
+ */
+struct BattleDamageReport {
+  std::vector<int> damagedBuildings;    // 受到伤害的建筑（含被摧毁的）
+  std::vector<int> destroyedBuildings;  // 本帧被摧毁的建筑
+  std::vector<int> killedSoldiers;      // 本帧死亡的士兵
+
+  void clear() {
+    damagedBuildings.clear();
+    destroyedBuildings.clear();
+    killedSoldiers.clear();
+  }
+};
+
+/**
+ * 逻辑帧内的伤害事件缓冲
+ * 士兵攻击、爆炸、法术和防御建筑只记录伤害事件，帧末统一结算：
+ * 按目标汇总伤害后一次性扣血并判定死亡。同一帧内的攻击方看到的是
+ * 同一份状态，结算结果与实体的更新顺序无关
+ */
+class BattleDamageBuffer {
+ public:
+  void addBuildingDamage(int building, BattleReal amount) {
+    _buildingEvents.push_back({building, amount});
+  }
+
+  void addSoldierDamage(int soldier, BattleReal amount) {
+    _soldierEvents.push_back({soldier, amount});
+  }
+
+  bool empty() const {
+    return _buildingEvents.empty() && _soldierEvents.empty();
+  }
+
+  /**
+   * 取出按建筑汇总的伤害（按 id 升序），并清空建筑伤害事件
+   */
+  void drainBuildings(std::vector<BattleDamageEvent>& totals);
+
+  /**
+   * 取出按士兵汇总的伤害（按 id 升序），并清空士兵伤害事件
+   */
+  void drainSoldiers(std::vector<BattleDamageEvent>& totals);
+
+  void clear();
+
+ private:
+  static void drain(std::vector<BattleDamageEvent>& events,
+                    std::vector<BattleDamageEvent>& totals);
+
+  std::vector<BattleDamageEvent> _buildingEvents;
+  std::vector<BattleDamageEvent> _soldierEvents;
+};
+
+#endif  // __BATTLE_DAMAGE_BUFFER_H__
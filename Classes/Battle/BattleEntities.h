@@ -0,0 +1,146 @@
+#ifndef __BATTLE_ENTITIES_H__
+#define __BATTLE_ENTITIES_H__
+
+#include <string>
+#include <vector>
+
+#include "Battle/BattleHandle.h"
+#include "Battle/BattleMath.h"
+#include "Battle/BattleSoldierArray.h"
+#include "Battle/BattleTypes.h"
+
+/**
+ * 无头战斗核心的纯数据实体
+ * 不依赖 cocos2d，游戏层的精灵只负责根据这些数据进行渲染
+ */
+
+/**
+ * 士兵属性（由 soilder.json 的配置换算得到）
+ */
+struct BattleSoldierStats {
+  BattleReal maxHP = 100.0f;
+  BattleReal attackDamage = 10.0f;
+  BattleReal attackSpeed = 1.0f;    // 每秒攻击次数
+  BattleReal moveSpeed = 100.0f;    // 像素/秒
+  BattleReal attackRange = 100.0f;  // 攻击范围（像素）
+  AttackType attackType = AttackType::ANY;
+  SoldierCategory category = SoldierCategory::LAND;
+
+  /**
+   * 将配置中的攻击速度换算为每秒攻击次数
+   * 配置值 > 10 视为速度值（100 对应 1次/秒），否则视为攻击间隔（秒）
+   */
+  static float attacksPerSecondFromConfig(float configValue) {
+    if (configValue > 10.0f) {
+      return configValue / 100.0f;
+    }
+    return (configValue > 0) ? (1.0f / configValue) : 1.0f;
+  }
+};
+
+/**
+ * 建筑属性（由 building.json 的配置得到）
+ */
+struct BattleBuildingStats {
+  BuildingType type = BuildingType::RESOURCE;
+  int gridCount = 1;
+  BattleReal maxHP = 1000.0f;
+  int damage = 0;                 // 防御建筑/陷阱伤害
+  BattleReal attackSpeed = 0.0f;  // 防御建筑每秒攻击次数
+  BattleReal attackRange = 0.0f;  // 攻击/触发范围（网格单位）
+};
+
+/**
+ * 法术属性（由 spell.json 的配置得到）
+ */
+struct BattleSpellStats {
+  SpellCategory category = SpellCategory::INSTANT;
+  BattleReal duration = 0.0f;  // 持续时间（秒）
+  BattleReal radius = 100.0f;  // 作用范围（像素）
+  BattleReal amount = 100.0f;  // 作用总量
+  BattleReal ratio = 1.0f;     // 倍率
+};
+
+/**
+ * 战斗中的建筑（包括城墙和陷阱）
+ */
+struct BattleBuilding {
+  int id = -1;
+  std::string name;
+  BuildingType type = BuildingType::RESOURCE;
+  int level = 1;
+  BattleReal row = 0.0f;  // 中心网格坐标
+  BattleReal col = 0.0f;
+  int gridCount = 1;
+  BattleVec2 position;  // 锚点（地图层坐标）
+  BattleReal maxHP = 0.0f;
+  BattleReal hp = 0.0f;
+
+  // 防御建筑
+  int damage = 0;
+  BattleReal attackSpeed = 0.0f;
+  BattleReal defenseRange = 0.0f;  // 攻击范围（像素）
+  BattleReal attackCooldown = 0.0f;
+  BattleHandle targetSoldier;  // 当前攻击的士兵
+
+  // 陷阱
+  BattleReal triggerRange = 0.0f;  // 触发范围（像素）
+  bool armed = false;              // 是否已布防
+
+  bool isAlive() const { return hp > 0; }
+
+  /**
+   * 是否可以被士兵和法术选中（陷阱对进攻方不可见）
+   */
+  bool isTargetable() const { return isAlive() && type != BuildingType::TRAP; }
+};
+
+/**
+ * 战斗中的法术
+ */
+struct BattleSpell {
+  int id = -1;
+  SpellType type = SpellType::HEAL;
+  BattleSpellStats stats;
+  BattleVec2 position;  // 施法位置
+  BattleReal elapsed = 0.0f;
+  bool active = false;
+  BattleReal healPerSecond = 0.0f;          // 治疗法术：每秒治疗量
+  std::vector<BattleHandle> ragedSoldiers;  // 狂暴法术：当前受影响的士兵
+};
+
+/**
+ * 战斗结果
+ */
+struct BattleResult {
+  int stars = 0;
+  float ratio = 0.0f;  // 摧毁比例（不含城墙）
+  bool win = false;
+
+  /**
+   * 根据建筑摧毁情况计算星级
+   * ratio = 被摧毁的建筑数量 / 总建筑数量；100% 为 3 星，
+   * >= 50% 时摧毁大本营 2 星否则 1 星，< 50% 时摧毁大本营 1 星否则 0 星
+   * @return totalCount 为 0 时返回 false
+   */
+  static bool evaluate(int totalCount, int destroyedCount,
+                       bool townHallDestroyed, BattleResult& result) {
+    result = BattleResult();
+    if (totalCount == 0) {
+      return false;
+    }
+
+    result.ratio = static_cast<float>(destroyedCount) / totalCount;
+    if (result.ratio >= 1.0f) {
+      result.stars = 3;
+    } else if (result.ratio >= 0.5f) {
+      result.stars = townHallDestroyed ? 2 : 1;
+    } else {
+      result.stars = townHallDestroyed ? 1 : 0;
+    }
+    result.win = (result.stars >= 1);
+    return true;
+  }
+};
+
+#endif  // __BATTLE_ENTITIES_H__
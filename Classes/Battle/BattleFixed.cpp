@@ -0,0 +1,41 @@
+#include "Battle/BattleFixed.h"
+
+namespace {
+// 逐位整数开方，返回 floor(sqrt(n))
+uint64_t isqrt(uint64_t n) {
+  uint64_t result = 0;
+  uint64_t bit = 1ULL << 62;
+  while (bit > n) {
+    bit >>= 2;
+  }
+  while (bit != 0) {
+    if (n >= result + bit) {
+      n -= result + bit;
+      result = (result >> 1) + bit;
+    } else {
+      result >>= 1;
+    }
+    bit >>= 2;
+  }
+  return result;
+}
+}  // namespace
+
+BattleFixed BattleFixed::sqrt(BattleFixed value) {
+  if (value._raw <= 0) {
+    return BattleFixed();
+  }
+  // sqrt(raw / 2^16) * 2^16 = sqrt(raw * 2^16)
+  uint64_t scaled = static_cast<uint64_t>(value._raw) << FRACTION_BITS;
+  return fromRaw(static_cast<int32_t>(isqrt(scaled)));
+}
+
+BattleFixed BattleFixed::hypot(BattleFixed x, BattleFixed y) {
+  // 平方和为 Q32.32，开方后恰好回到 Q16.16
+  int64_t rx = x._raw;
+  int64_t ry = y._raw;
+  uint64_t sum =
+      static_cast<uint64_t>(rx * rx) + static_cast<uint64_t>(ry * ry);
+  uint64_t root = isqrt(sum);
+  return fromRaw(root > INT32_MAX ? INT32_MAX : static_cast<int32_t>(root));
+}
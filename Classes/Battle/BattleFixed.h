@@ -0,0 +1,123 @@
+#ifndef __BATTLE_FIXED_H__
+#define __BATTLE_FIXED_H__
+
+#include <cmath>
+#include <cstdint>
+
+/**
+ * Q16.16 定点数
+ * 高 16 位为整数部分，低 16 位为小数部分，可表示约 ±32768，精度 1/65536。
+ * 加减乘除与开方只使用整数运算，不同平台（x86、ARM）上结果逐位一致。
+ * 乘除法使用 64 位中间值，结果向负无穷取整；除以 0 时饱和到最大/最小值
+ */
+class BattleFixed {
+ public:
+  static const int FRACTION_BITS = 16;
+  static const int32_t ONE = 1 << FRACTION_BITS;
+
+  constexpr BattleFixed() : _raw(0) {}
+  constexpr BattleFixed(int value) : _raw(value * ONE) {}
+
+  /**
+   * 由浮点数构造，四舍五入到最近的定点值
+   * 仅用于配置、常量等输入，模拟过程中不应再产生浮点数
+   */
+  BattleFixed(float value)
+      : _raw(static_cast<int32_t>(std::lround(value * ONE))) {}
+  BattleFixed(double value)
+      : _raw(static_cast<int32_t>(std::llround(value * ONE))) {}
+
+  static BattleFixed fromRaw(int32_t raw) {
+    BattleFixed result;
+    result._raw = raw;
+    return result;
+  }
+
+  int32_t raw() const { return _raw; }
+
+  /**
+   * 转换为浮点数（用于渲染和日志）
+   */
+  explicit operator float() const {
+    return static_cast<float>(_raw) / ONE;
+  }
+
+  /**
+   * 转换为整数，向零取整（与 float 转 int 一致）
+   */
+  explicit operator int() const { return _raw / ONE; }
+
+  static BattleFixed max() { return fromRaw(INT32_MAX); }
+  static BattleFixed lowest() { return fromRaw(INT32_MIN); }
+
+  /**
+   * 平方根（负数返回 0）
+   */
+  static BattleFixed sqrt(BattleFixed value);
+
+  /**
+   * 计算 sqrt(x * x + y * y)，中间值使用 64 位，坐标较大时也不会溢出
+   */
+  static BattleFixed hypot(BattleFixed x, BattleFixed y);
+
+  BattleFixed operator-() const { return fromRaw(-_raw); }
+
+  BattleFixed& operator+=(BattleFixed v) {
+    _raw += v._raw;
+    return *this;
+  }
+  BattleFixed& operator-=(BattleFixed v) {
+    _raw -= v._raw;
+    return *this;
+  }
+  BattleFixed& operator*=(BattleFixed v) {
+    *this = *this * v;
+    return *this;
+  }
+  BattleFixed& operator/=(BattleFixed v) {
+    *this = *this / v;
+    return *this;
+  }
+
+  friend BattleFixed operator+(BattleFixed a, BattleFixed b) {
+    return fromRaw(a._raw + b._raw);
+  }
+  friend BattleFixed operator-(BattleFixed a, BattleFixed b) {
+    return fromRaw(a._raw - b._raw);
+  }
+  friend BattleFixed operator*(BattleFixed a, BattleFixed b) {
+    int64_t product = static_cast<int64_t>(a._raw) * b._raw;
+    return fromRaw(static_cast<int32_t>(product >> FRACTION_BITS));
+  }
+  friend BattleFixed operator/(BattleFixed a, BattleFixed b) {
+    if (b._raw == 0) {
+      return a._raw >= 0 ? max() : lowest();
+    }
+    int64_t dividend = static_cast<int64_t>(a._raw) * ONE;
+    return fromRaw(static_cast<int32_t>(dividend / b._raw));
+  }
+
+  friend bool operator==(BattleFixed a, BattleFixed b) {
+    return a._raw == b._raw;
+  }
+  friend bool operator!=(BattleFixed a, BattleFixed b) {
+    return a._raw != b._raw;
+  }
+  friend bool operator<(BattleFixed a, BattleFixed b) {
+    return a._raw < b._raw;
+  }
+  friend bool operator<=(BattleFixed a, BattleFixed b) {
+    return a._raw <= b._raw;
+  }
+  friend bool operator>(BattleFixed a, BattleFixed b) {
+    return a._raw > b._raw;
+  }
+  friend bool operator>=(BattleFixed a, BattleFixed b) {
+    return a._raw >= b._raw;
+  }
+
+ private:
+  int32_t _raw;
+};
+
+#endif  // __BATTLE_FIXED_H__
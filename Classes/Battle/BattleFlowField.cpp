@@ -0,0 +1,320 @@
+#include "Battle/BattleFlowField.h"
+
+#include <algorithm>
+
+#include "Battle/BattlePathFinder.h"
+
+namespace {
+// 8方向移动偏移，直线代价10，对角线14
+const int kDr[] = {0, 0, 1, -1, 1, 1, -1, -1};
+const int kDc[] = {1, -1, 0, 0, 1, -1, 1, -1};
+const int kCost[] = {10, 10, 10, 10, 14, 14, 14, 14};
+}  // namespace
+
+const int BattleFlowField::UNREACHABLE;
+
+bool BattleFlowField::build(const BattleVec2& endPos,
+                            const BattleProjection& projection,
+                            const BattleGrid& grid, int precision) {
+  return buildOn(endPos, projection, grid, precision);
+}
+
+bool BattleFlowField::build(const BattleVec2& endPos,
+                            const BattleProjection& projection,
+                            const BattleGridView& grid, int precision) {
+  return buildOn(endPos, projection, grid, precision);
+}
+
+bool BattleFlowField::build(const BattleGoalSet& goals,
+                            const BattleGrid& grid) {
+  return buildOn(goals, grid);
+}
+
+bool BattleFlowField::build(const BattleGoalSet& goals,
+                            const BattleGridView& grid) {
+  return buildOn(goals, grid);
+}
+
+bool BattleFlowField::repair(const BattleGrid& grid,
+                             const std::vector<BattleGridArea>& areas) {
+  return repairOn(grid, areas, nullptr);
+}
+
+bool BattleFlowField::repair(const BattleGridView& grid,
+                             const std::vector<BattleGridArea>& areas) {
+  return repairOn(grid, areas, nullptr);
+}
+
+bool BattleFlowField::repair(const BattleGrid& grid,
+                             const std::vector<BattleGridArea>& areas,
+                             const BattleGoalSet& goals) {
+  return repairOn(grid, areas, &goals);
+}
+
+bool BattleFlowField::repair(const BattleGridView& grid,
+                             const std::vector<BattleGridArea>& areas,
+                             const BattleGoalSet& goals) {
+  return repairOn(grid, areas, &goals);
+}
+
+template <typename Grid>
+bool BattleFlowField::buildOn(const BattleVec2& endPos,
+                              const BattleProjection& projection,
+                              const Grid& grid, int precision) {
+  _precision = precision;
+  _size = grid.getSize() * precision;
+  const int cellCount = _size * _size;
+  _cost.assign(cellCount, UNREACHABLE);
+  _goals.clear();
+  _goalSet = false;
+
+  BattleReal endRow, endCol;
+  if (_size <= 0 || !projection.screenToGrid(endPos, endRow, endCol)) {
+    return false;
+  }
+  _endRow = BattleMath::round(endRow * precision);
+  _endCol = BattleMath::round(endCol * precision);
+  if (!BattlePathFinder::findGoalCells(_endRow, _endCol, grid, precision,
+                                       _goals)) {
+    return false;
+  }
+  fill(grid);
+  return true;
+}
+
+template <typename Grid>
+bool BattleFlowField::buildOn(const BattleGoalSet& goals, const Grid& grid) {
+  _precision = goals.getPrecision();
+  _size = grid.getSize() * _precision;
+  _cost.assign(_size * _size, UNREACHABLE);
+  _goals.clear();
+  _goalSet = true;
+  if (_size <= 0 || goals.getSize() != _size || goals.empty()) {
+    return false;
+  }
+  _goals = goals.getCells();
+  fill(grid);
+  return true;
+}
+
+template <typename Grid>
+void BattleFlowField::fill(const Grid& grid) {
+  // 一个大格子内的所有子网格可通行性相同
+  _walkable.resize(_size * _size);
+  for (int r = 0; r < _size; ++r) {
+    for (int c = 0; c < _size; ++c) {
+      _walkable[r * _size + c] =
+          grid.isWalkable(r / _precision, c / _precision);
+    }
+  }
+
+  // 从所有终点同时出发的 Dijkstra（代价对称，反向搜索即正向代价）
+  _seeds.clear();
+  for (int goal : _goals) {
+    _cost[goal] = 0;
+    _seeds.emplace_back(0, goal);
+  }
+  propagate();
+}
+
+template <typename Grid>
+bool BattleFlowField::repairOn(const Grid& grid,
+                               const std::vector<BattleGridArea>& areas,
+                               const BattleGoalSet* goals) {
+  if (_goals.empty() || _size != grid.getSize() * _precision ||
+      _goalSet != (goals != nullptr) ||
+      (goals && goals->getSize() != _size)) {
+    return false;
+  }
+
+  // 更新变化区域内子网格的可通行性，记录新开放的子网格
+  std::vector<int> opened;
+  const int gridSize = grid.getSize();
+  for (const BattleGridArea& area : areas) {
+    int row1 = std::min(area.row1, gridSize - 1);
+    int col1 = std::min(area.col1, gridSize - 1);
+    for (int r = std::max(area.row0, 0); r <= row1; ++r) {
+      for (int c = std::max(area.col0, 0); c <= col1; ++c) {
+        bool walkable = grid.isWalkable(r, c);
+        for (int sr = r * _precision; sr < (r + 1) * _precision; ++sr) {
+          for (int sc = c * _precision; sc < (c + 1) * _precision; ++sc) {
+            int cell = sr * _size + sc;
+            if (_walkable[cell] == walkable) {
+              continue;
+            }
+            if (!walkable) {
+              return false;
+            }
+            _walkable[cell] = 1;
+            opened.push_back(cell);
+          }
+        }
+      }
+    }
+  }
+
+  // 终点取决于目标周围的可通行性，原有终点必须仍然有效
+  if (goals) {
+    _newGoals = goals->getCells();  // 已按下标排序
+  } else if (BattlePathFinder::findGoalCells(_endRow, _endCol, grid,
+                                             _precision, _newGoals)) {
+    std::sort(_newGoals.begin(), _newGoals.end());
+  } else {
+    return false;
+  }
+  if (_newGoals.empty()) {
+    return false;
+  }
+  for (int goal : _goals) {
+    if (!std::binary_search(_newGoals.begin(), _newGoals.end(), goal)) {
+      return false;
+    }
+  }
+  _goals.swap(_newGoals);
+
+  // 新终点的代价为 0，新开放的子网格取相邻子网格代价加移动代价的最小值。
+  // 其余子网格的代价只可能经过这些子网格下降
+  _seeds.clear();
+  for (int goal : _goals) {
+    if (_cost[goal] != 0) {
+      _cost[goal] = 0;
+      _seeds.emplace_back(0, goal);
+    }
+  }
+  for (int cell : opened) {
+    int row = cell / _size;
+    int col = cell % _size;
+    int best = _cost[cell];
+    for (int i = 0; i < 8; ++i) {
+      int cost = getCost(row + kDr[i], col + kDc[i]);
+      if (cost != UNREACHABLE && cost + kCost[i] < best) {
+        best = cost + kCost[i];
+      }
+    }
+    if (best < _cost[cell]) {
+      _cost[cell] = best;
+      _seeds.emplace_back(best, cell);
+    }
+  }
+  std::sort(_seeds.begin(), _seeds.end());
+  propagate();
+  return true;
+}
+
+void BattleFlowField::propagate() {
+  // 边的代价只有 10 和 14，用环形桶队列代替堆：桶 i 存放代价模
+  // BUCKET_COUNT 等于 i 的子网格，按代价递增依次取出。
+  // 起点按代价排序，在取到对应代价时放入桶中
+  for (std::vector<int>& bucket : _buckets) {
+    bucket.clear();
+  }
+  _visited = 0;
+  int pending = 0;
+  size_t nextSeed = 0;
+  int cost = _seeds.empty() ? 0 : _seeds[0].first;
+  while (pending > 0 || nextSeed < _seeds.size()) {
+    if (pending == 0) {
+      cost = std::max(cost, _seeds[nextSeed].first);
+    }
+    std::vector<int>& bucket = _buckets[cost % BUCKET_COUNT];
+    for (; nextSeed < _seeds.size() && _seeds[nextSeed].first == cost;
+         ++nextSeed) {
+      bucket.push_back(_seeds[nextSeed].second);
+      pending++;
+    }
+
+    // 处理过程中只会向其他桶添加（边代价 > 0 且 < BUCKET_COUNT）
+    for (size_t k = 0; k < bucket.size(); ++k) {
+      int cell = bucket[k];
+      pending--;
+      if (_cost[cell] != cost) {
+        continue;  // 已有更短的代价
+      }
+      _visited++;
+
+      int row = cell / _size;
+      int col = cell % _size;
+      for (int i = 0; i < 8; ++i) {
+        int nr = row + kDr[i];
+        int nc = col + kDc[i];
+        if (nr < 0 || nr >= _size || nc < 0 || nc >= _size) {
+          continue;
+        }
+        int neighbor = nr * _size + nc;
+        int newCost = cost + kCost[i];
+        if (!_walkable[neighbor] || newCost >= _cost[neighbor]) {
+          continue;
+        }
+        _cost[neighbor] = newCost;
+        _buckets[newCost % BUCKET_COUNT].push_back(neighbor);
+        pending++;
+      }
+    }
+    bucket.clear();
+    cost++;
+  }
+}
+
+bool BattleFlowField::nextStep(int& row, int& col) const {
+  int current = getCost(row, col);
+  if (current == 0) {
+    return false;
+  }
+
+  // 选择 代价 + 移动代价 最小的相邻子网格，保证代价严格下降
+  int bestRow = -1;
+  int bestCol = -1;
+  int bestCost = UNREACHABLE;
+  for (int i = 0; i < 8; ++i) {
+    int nr = row + kDr[i];
+    int nc = col + kDc[i];
+    int cost = getCost(nr, nc);
+    if (cost == UNREACHABLE || cost >= current) {
+      continue;
+    }
+    if (cost + kCost[i] < bestCost) {
+      bestCost = cost + kCost[i];
+      bestRow = nr;
+      bestCol = nc;
+    }
+  }
+  if (bestRow < 0) {
+    return false;
+  }
+  row = bestRow;
+  col = bestCol;
+  return true;
+}
+
+std::vector<BattleVec2> BattleFlowField::tracePath(
+    const BattleVec2& startPos, const BattleProjection& projection) const {
+  BattleReal startRow, startCol;
+  if (_size <= 0 || !projection.screenToGrid(startPos, startRow, startCol)) {
+    return {};
+  }
+
+  // 起点可能恰好位于地图边界上
+  int row = std::min(std::max(BattleMath::round(startRow * _precision), 0),
+                     _size - 1);
+  int col = std::min(std::max(BattleMath::round(startCol * _precision), 0),
+                     _size - 1);
+
+  auto cellCenter = [&](int r, int c) {
+    return projection.gridToScene((BattleReal(r) + 0.5f) / _precision,
+                                  (BattleReal(c) + 0.5f) / _precision);
+  };
+
+  // 起点即终点
+  if (getCost(row, col) == 0) {
+    return {cellCenter(row, col)};
+  }
+
+  std::vector<BattleVec2> path;
+  while (getCost(row, col) != 0) {
+    if (!nextStep(row, col)) {
+      return {};
+    }
+    path.push_back(cellCenter(row, col));
+  }
+  return path;
+}
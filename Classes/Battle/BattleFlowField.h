@@ -0,0 +1,130 @@
+#ifndef __BATTLE_FLOW_FIELD_H__
+#define __BATTLE_FLOW_FIELD_H__
+
+#include <utility>
+#include <vector>
+
+#include "Battle/BattleGoalSet.h"
+#include "Battle/BattleGrid.h"
+
+/**
+ * 流场（积分场）
+ * 以目标周围的有效终点为源点，在子网格上反向运行 Dijkstra，得到每个
+ * 子网格到最近终点的路径代价（直线10，对角线14，与 A* 相同）。
+ * 同一目标的所有士兵共用一个流场，每一步只需比较相邻 8 个子网格的代价。
+ * 墙壁或建筑被摧毁后代价只会下降，可以从变化的子网格出发局部修复
+ */
+class BattleFlowField {
+ public:
+  static const int UNREACHABLE = 0x7FFFFFFF;
+
+  /**
+   * 构建流场
+   * @param endPos 目标位置（地图层坐标）
+   * @param projection 网格投影参数
+   * @param grid 可通行网格，也可以是叠加了覆盖层的 BattleGridView
+   * @param precision 精度倍数，每个网格被划分为 precision*precision 个子网格
+   * @return 是否找到有效终点
+   */
+  bool build(const BattleVec2& endPos, const BattleProjection& projection,
+             const BattleGrid& grid, int precision);
+  bool build(const BattleVec2& endPos, const BattleProjection& projection,
+             const BattleGridView& grid, int precision);
+
+  /**
+   * 以攻击位集合为终点构建流场，精度与集合相同
+   * @return 集合与网格大小一致且不为空
+   */
+  bool build(const BattleGoalSet& goals, const BattleGrid& grid);
+  bool build(const BattleGoalSet& goals, const BattleGridView& grid);
+
+  /**
+   * 网格中 areas 区域的阻挡被移除后局部修复流场（类似 LPA*）
+   * 只从新开放的子网格和新增的终点出发传播下降的代价，结果与重新构建
+   * 相同。区域内有子网格变为阻挡或原有终点失效时代价可能上升，返回
+   * false，此时流场需要重新构建
+   * @param grid 修改后的可通行网格
+   * @param areas 上次构建或修复之后发生变化的全部区域
+   */
+  bool repair(const BattleGrid& grid, const std::vector<BattleGridArea>& areas);
+  bool repair(const BattleGridView& grid,
+              const std::vector<BattleGridArea>& areas);
+
+  /**
+   * 以攻击位集合构建的流场使用重新计算后的集合修复
+   */
+  bool repair(const BattleGrid& grid, const std::vector<BattleGridArea>& areas,
+              const BattleGoalSet& goals);
+  bool repair(const BattleGridView& grid,
+              const std::vector<BattleGridArea>& areas,
+              const BattleGoalSet& goals);
+
+  /**
+   * 最近一次构建或修复确定代价的子网格数
+   */
+  int getLastVisitedCount() const { return _visited; }
+
+  int getPrecision() const { return _precision; }
+  int getSize() const { return _size; }
+
+  /**
+   * 子网格到最近终点的代价，越界或无法到达时返回 UNREACHABLE
+   */
+  int getCost(int row, int col) const {
+    if (row < 0 || row >= _size || col < 0 || col >= _size) {
+      return UNREACHABLE;
+    }
+    return _cost[row * _size + col];
+  }
+
+  /**
+   * 沿流场前进一步：移动到代价最小的相邻子网格
+   * 当前子网格不可通行时（例如士兵站在建筑边缘）也可以从相邻子网格出发
+   * @return 已经到达终点或无法到达时返回 false
+   */
+  bool nextStep(int& row, int& col) const;
+
+  /**
+   * 从起点沿流场生成路径，格式与 BattlePathFinder::findPath 相同
+   * @return 路径点列表（地图层坐标），无法到达时返回空列表
+   */
+  std::vector<BattleVec2> tracePath(const BattleVec2& startPos,
+                                    const BattleProjection& projection) const;
+
+ private:
+  static const int BUCKET_COUNT = 16;  // 大于最大边代价 14
+
+  // build / repair 的实现，Grid 为 BattleGrid 或 BattleGridView
+  template <typename Grid>
+  bool buildOn(const BattleVec2& endPos, const BattleProjection& projection,
+               const Grid& grid, int precision);
+  template <typename Grid>
+  bool buildOn(const BattleGoalSet& goals, const Grid& grid);
+  template <typename Grid>
+  bool repairOn(const Grid& grid, const std::vector<BattleGridArea>& areas,
+                const BattleGoalSet* goals);
+
+  // 按网格填充子网格的可通行性，从 _goals 出发计算代价
+  template <typename Grid>
+  void fill(const Grid& grid);
+
+  // 从 _seeds（代价, 子网格）出发运行 Dijkstra，只更新代价更小的子网格
+  void propagate();
+
+  int _precision = 0;
+  int _size = 0;  // 子网格边长
+  int _endRow = 0;  // 目标所在子网格
+  int _endCol = 0;
+  bool _goalSet = false;  // 终点来自 BattleGoalSet
+  int _visited = 0;
+  std::vector<int> _cost;
+
+  // 构建用的临时数组，重建时复用
+  std::vector<unsigned char> _walkable;     // 子网格是否可通行
+  std::vector<int> _buckets[BUCKET_COUNT];  // Dijkstra 的环形桶队列
+  std::vector<int> _goals;                  // 有效终点
+  std::vector<int> _newGoals;               // 修复时重新计算的终点
+  std::vector<std::pair<int, int>> _seeds;  // 传播的起点（代价, 子网格）
+};
+
+#endif  // __BATTLE_FLOW_FIELD_H__
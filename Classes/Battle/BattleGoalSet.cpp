@@ -0,0 +1,97 @@
+#include "Battle/BattleGoalSet.h"
+
+#include <algorithm>
+
+bool BattleGoalSet::isInRange(const BattleVec2& position, BattleReal posRow,
+                              BattleReal posCol, BattleReal row,
+                              BattleReal col, int gridCount,
+                              BattleReal attackRange,
+                              const BattleProjection& projection) {
+  BattleReal halfSize = BattleReal(gridCount) / 2;
+
+  // 对 1x1 建筑（如墙）收缩不能超过建筑一半大小，否则判定框会消失或反转
+  BattleReal shrink = std::min<BattleReal>(0.3f, halfSize - 0.1f);
+
+  BattleReal minRow = row - halfSize + shrink;
+  BattleReal maxRow = row + halfSize - shrink;
+  BattleReal minCol = col - halfSize + shrink;
+  BattleReal maxCol = col + halfSize - shrink;
+
+  // 网格上距离士兵最近的建筑边缘点
+  BattleReal closestRow = std::max(minRow, std::min(posRow, maxRow));
+  BattleReal closestCol = std::max(minCol, std::min(posCol, maxCol));
+  BattleVec2 closestPos = projection.gridToScene(closestRow, closestCol);
+
+  return position.distance(closestPos) <= attackRange;
+}
+
+BattleGridArea BattleGoalSet::getReachArea(
+    BattleReal row, BattleReal col, int gridCount, BattleReal attackRange,
+    const BattleProjection& projection) {
+  // 网格坐标上移动 d 时地图层距离不小于 d * min(deltaX, deltaY)；
+  // 判定框与 BattleGridArea::around 的取整方式不同，再多留一格
+  BattleReal unit = std::min(projection.deltaX, projection.deltaY);
+  int reach = projection.gridSize;
+  if (unit > 0.0f) {
+    reach = std::min(BattleMath::round(attackRange / unit) + 2, reach);
+  }
+  return BattleGridArea::around(static_cast<int>(row), static_cast<int>(col),
+                                gridCount)
+      .expanded(reach);
+}
+
+bool BattleGoalSet::build(BattleReal row, BattleReal col, int gridCount,
+                          BattleReal attackRange,
+                          const BattleProjection& projection,
+                          const BattleGrid& grid, int precision) {
+  return buildOn(row, col, gridCount, attackRange, projection, grid,
+                 precision);
+}
+
+bool BattleGoalSet::build(BattleReal row, BattleReal col, int gridCount,
+                          BattleReal attackRange,
+                          const BattleProjection& projection,
+                          const BattleGridView& grid, int precision) {
+  return buildOn(row, col, gridCount, attackRange, projection, grid,
+                 precision);
+}
+
+template <typename Grid>
+bool BattleGoalSet::buildOn(BattleReal row, BattleReal col, int gridCount,
+                            BattleReal attackRange,
+                            const BattleProjection& projection,
+                            const Grid& grid, int precision) {
+  _precision = precision;
+  _size = grid.getSize() * precision;
+  _bits.assign((static_cast<size_t>(std::max(_size, 0)) * _size + 63) / 64,
+               0);
+  _cells.clear();
+  if (_size <= 0) {
+    return false;
+  }
+
+  BattleGridArea area =
+      getReachArea(row, col, gridCount, attackRange, projection);
+  int row0 = std::max(area.row0, 0) * precision;
+  int col0 = std::max(area.col0, 0) * precision;
+  int row1 = std::min((area.row1 + 1) * precision, _size) - 1;
+  int col1 = std::min((area.col1 + 1) * precision, _size) - 1;
+
+  for (int r = row0; r <= row1; ++r) {
+    for (int c = col0; c <= col1; ++c) {
+      if (!grid.isWalkable(r / precision, c / precision)) {
+        continue;
+      }
+      BattleReal cellRow = (BattleReal(r) + 0.5f) / precision;
+      BattleReal cellCol = (BattleReal(c) + 0.5f) / precision;
+      BattleVec2 center = projection.gridToScene(cellRow, cellCol);
+      if (isInRange(center, cellRow, cellCol, row, col, gridCount,
+                    attackRange, projection)) {
+        int cell = r * _size + c;
+        _bits[cell >> 6] |= uint64_t(1) << (cell & 63);
+        _cells.push_back(cell);
+      }
+    }
+  }
+  return !_cells.empty();
+}
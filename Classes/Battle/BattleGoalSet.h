@@ -0,0 +1,77 @@
+#ifndef __BATTLE_GOAL_SET_H__
+#define __BATTLE_GOAL_SET_H__
+
+#include <cstdint>
+#include <vector>
+
+#include "Battle/BattleGrid.h"
+
+/**
+ * 攻击位集合
+ * 子网格中可以攻击到目标建筑的可通行位置，以子网格中心（路径点所在的
+ * 位置）按 isInRange 判定。按位存放供搜索判断终点，同时保留按下标排序
+ * 的列表作为流场的源点。只取决于建筑、攻击范围和网格，网格变化后重新计算
+ */
+class BattleGoalSet {
+ public:
+  /**
+   * 士兵能否攻击到建筑
+   * 建筑矩形向内收缩一点，让士兵必须走进一点才能攻击；
+   * 取网格上距离士兵最近的矩形内点，按地图层距离与攻击范围比较
+   * @param position 士兵位置（地图层坐标）
+   * @param posRow 士兵所在的网格坐标
+   * @param row 建筑中心行坐标
+   * @param col 建筑中心列坐标
+   * @param gridCount 建筑尺寸
+   */
+  static bool isInRange(const BattleVec2& position, BattleReal posRow,
+                        BattleReal posCol, BattleReal row, BattleReal col,
+                        int gridCount, BattleReal attackRange,
+                        const BattleProjection& projection);
+
+  /**
+   * 可能包含攻击位的网格范围（建筑周围攻击范围以内，不裁剪到地图内），
+   * 网格变化与它不相交时攻击位不变
+   */
+  static BattleGridArea getReachArea(BattleReal row, BattleReal col,
+                                     int gridCount, BattleReal attackRange,
+                                     const BattleProjection& projection);
+
+  /**
+   * 计算攻击位
+   * @param grid 可通行网格，也可以是叠加了覆盖层的 BattleGridView
+   * @param precision 精度倍数，与使用它的流场或寻路相同
+   * @return 是否至少有一个攻击位
+   */
+  bool build(BattleReal row, BattleReal col, int gridCount,
+             BattleReal attackRange, const BattleProjection& projection,
+             const BattleGrid& grid, int precision);
+  bool build(BattleReal row, BattleReal col, int gridCount,
+             BattleReal attackRange, const BattleProjection& projection,
+             const BattleGridView& grid, int precision);
+
+  /**
+   * 子网格（row * size + col）是否为攻击位
+   */
+  bool contains(int cell) const {
+    return (_bits[cell >> 6] >> (cell & 63)) & 1;
+  }
+
+  const std::vector<int>& getCells() const { return _cells; }
+  bool empty() const { return _cells.empty(); }
+  int getPrecision() const { return _precision; }
+  int getSize() const { return _size; }
+
+ private:
+  template <typename Grid>
+  bool buildOn(BattleReal row, BattleReal col, int gridCount,
+               BattleReal attackRange, const BattleProjection& projection,
+               const Grid& grid, int precision);
+
+  int _precision = 0;
+  int _size = 0;  // 子网格边长
+  std::vector<uint64_t> _bits;
+  std::vector<int> _cells;
+};
+
+#endif  // __BATTLE_GOAL_SET_H__
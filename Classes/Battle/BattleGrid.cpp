@@ -0,0 +1,73 @@
+#include "Battle/BattleGrid.h"
+
+#include <algorithm>
+
+namespace {
+// 攻击范围每格按网格边长的 0.6 倍计
+const BattleReal kRangeGridScale = 0.6f;
+}  // namespace
+
+BattleVec2 BattleProjection::gridToScene(BattleReal row, BattleReal col) const {
+  return BattleVec2(p00.x + (row + col) * deltaX,
+                    p00.y + (col - row) * deltaY);
+}
+
+bool BattleProjection::screenToGrid(const BattleVec2& pos, BattleReal& row,
+                                    BattleReal& col) const {
+  // 逆变换：
+  // dx = (row + col) * deltaX
+  // dy = (col - row) * deltaY
+  BattleReal dx = pos.x - p00.x;
+  BattleReal dy = pos.y - p00.y;
+
+  col = (dx / deltaX + dy / deltaY) / 2.0f;
+  row = (dx / deltaX - dy / deltaY) / 2.0f;
+
+  BattleReal size = gridSize;
+  return (row >= 0.0f && row <= size && col >= 0.0f && col <= size);
+}
+
+BattleVec2 BattleProjection::buildingAnchor(BattleReal row, BattleReal col,
+                                            int gridCount) const {
+  BattleVec2 anchor = gridToScene(row, col);
+  if (gridCount % 2 != 0) {
+    anchor.x += deltaX;
+  }
+  return anchor;
+}
+
+BattleReal BattleProjection::gridPixelLength() const {
+  if (deltaX <= 0.0f) {
+    return 50.0f;  // 默认安全值
+  }
+  return BattleMath::length(deltaX, deltaY);
+}
+
+BattleReal BattleProjection::rangeToPixels(BattleReal gridRange) const {
+  return gridRange * gridPixelLength() * kRangeGridScale;
+}
+
+BattleGrid::BattleGrid(int size)
+    : _size(size),
+      _words((std::max(size, 0) + 63) / 64),
+      _rows(static_cast<size_t>(std::max(size, 0)) * _words, 0),
+      _version(0) {}
+
+void BattleGrid::setArea(int row, int col, int size, bool blocked) {
+  BattleGridArea area = BattleGridArea::around(row, col, size);
+  for (int r = area.row0; r <= area.row1; ++r) {
+    for (int c = area.col0; c <= area.col1; ++c) {
+      if (isValid(r, c)) {
+        uint64_t& word = _rows[r * _words + (c >> 6)];
+        uint64_t bit = uint64_t(1) << (c & 63);
+        word = blocked ? (word | bit) : (word & ~bit);
+      }
+    }
+  }
+  _version++;
+}
+
+void BattleGrid::clear() {
+  std::fill(_rows.begin(), _rows.end(), 0);
+  _version++;
+}
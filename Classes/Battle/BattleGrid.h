@@ -0,0 +1,196 @@
+#ifndef __BATTLE_GRID_H__
+#define __BATTLE_GRID_H__
+
+#include <cstdint>
+#include <vector>
+
+#include "Battle/BattleMath.h"
+
+/**
+ * 等距网格投影
+ * 网格坐标(row, col)与地图层坐标之间的转换，公式与 GridUtils 相同，
+ * 但参数由调用方传入，不读取 ConfigManager
+ */
+struct BattleProjection {
+  BattleVec2 p00;        // 地图原点p[0][0]的位置
+  BattleReal deltaX = 40.0f;  // 网格间距X
+  BattleReal deltaY = 30.0f;  // 网格间距Y
+  int gridSize = 44;     // 网格边长
+
+  /**
+   * 将网格坐标转换为地图层坐标（grass顶点位置）
+   */
+  BattleVec2 gridToScene(BattleReal row, BattleReal col) const;
+
+  /**
+   * 将地图层坐标转换为网格坐标
+   * @return 是否在有效范围内
+   */
+  bool screenToGrid(const BattleVec2& pos, BattleReal& row,
+                    BattleReal& col) const;
+
+  /**
+   * 计算建筑的锚点位置
+   * 奇数尺寸的建筑中心位于网格中心，需要向右偏移 deltaX（与
+   * BuildingManager::createBuilding 一致）
+   */
+  BattleVec2 buildingAnchor(BattleReal row, BattleReal col,
+                            int gridCount) const;
+
+  /**
+   * 1 个网格边长对应的像素长度
+   */
+  BattleReal gridPixelLength() const;
+
+  /**
+   * 建筑配置的 attackRange（网格数）换算为像素距离，防御建筑和陷阱共用
+   */
+  BattleReal rangeToPixels(BattleReal gridRange) const;
+};
+
+/**
+ * 网格上的矩形区域 [row0, row1] x [col0, col1]（闭区间）
+ */
+struct BattleGridArea {
+  int row0 = 0;
+  int col0 = 0;
+  int row1 = -1;
+  int col1 = -1;
+
+  /**
+   * 建筑占据的区域，规则与 BattleGrid::setArea 相同
+   * 奇数 size：范围 [c - s/2, c + s/2]；偶数 size：范围 [c - s/2, c + s/2 - 1]
+   */
+  static BattleGridArea around(int row, int col, int size) {
+    BattleGridArea area;
+    area.row0 = row - size / 2;
+    area.col0 = col - size / 2;
+    area.row1 = area.row0 + size - 1;
+    area.col1 = area.col0 + size - 1;
+    return area;
+  }
+
+  bool contains(int row, int col) const {
+    return row >= row0 && row <= row1 && col >= col0 && col <= col1;
+  }
+
+  bool intersects(const BattleGridArea& other) const {
+    return row0 <= other.row1 && other.row0 <= row1 && col0 <= other.col1 &&
+           other.col0 <= col1;
+  }
+
+  /**
+   * 向四周各扩展 n 格
+   */
+  BattleGridArea expanded(int n) const {
+    BattleGridArea area = *this;
+    area.row0 -= n;
+    area.col0 -= n;
+    area.row1 += n;
+    area.col1 += n;
+    return area;
+  }
+};
+
+/**
+ * 战斗网格
+ * 记录每个网格是否被建筑占据，占地规则与 BuildingManager::updateGridState 相同。
+ * 每行按位打包为 64 位字（位为 1 表示阻挡），寻路时可以整字读取
+ */
+class BattleGrid {
+ public:
+  explicit BattleGrid(int size = 44);
+
+  int getSize() const { return _size; }
+
+  /**
+   * 每行占用的 64 位字数
+   */
+  int getWordsPerRow() const { return _words; }
+
+  /**
+   * 第 row 行第 word 个字的阻挡位，第 i 位对应列 word * 64 + i
+   */
+  uint64_t getBlockedWord(int row, int word) const {
+    return _rows[row * _words + word];
+  }
+
+  /**
+   * 检查网格坐标是否有效
+   */
+  bool isValid(int row, int col) const {
+    return row >= 0 && row < _size && col >= 0 && col < _size;
+  }
+
+  /**
+   * 检查指定网格是否可通行（越界视为不可通行）
+   */
+  bool isWalkable(int row, int col) const {
+    return isValid(row, col) &&
+           ((getBlockedWord(row, col >> 6) >> (col & 63)) & 1) == 0;
+  }
+
+  /**
+   * 更新建筑占据区域的状态
+   * @param row 建筑中心行坐标
+   * @param col 建筑中心列坐标
+   * @param size 占用网格大小（边长）
+   * @param blocked 是否阻挡
+   */
+  void setArea(int row, int col, int size, bool blocked);
+
+  /**
+   * 清空所有阻挡
+   */
+  void clear();
+
+  /**
+   * 网格版本号，每次修改阻挡状态后递增，用于判断寻路缓存是否过期
+   */
+  unsigned getVersion() const { return _version; }
+
+ private:
+  int _size;
+  int _words;
+  std::vector<uint64_t> _rows;  // 按行打包的阻挡位
+  unsigned _version;
+};
+
+/**
+ * 叠加了可通行覆盖层的网格视图，不复制网格
+ * overlay 中阻挡位为 1 的网格视为可通行，例如把墙壁所在的网格作为覆盖层，
+ * 得到炸弹人穿墙寻路使用的网格。接口与 BattleGrid 的只读部分相同，
+ * 寻路和流场对两者按模板实例化
+ */
+class BattleGridView {
+ public:
+  /**
+   * @param grid 底层网格
+   * @param overlay 覆盖层，为空时与 grid 相同；大小必须与 grid 相同
+   */
+  explicit BattleGridView(const BattleGrid& grid,
+                          const BattleGrid* overlay = nullptr)
+      : _grid(&grid), _overlay(overlay) {}
+
+  int getSize() const { return _grid->getSize(); }
+  int getWordsPerRow() const { return _grid->getWordsPerRow(); }
+  unsigned getVersion() const { return _grid->getVersion(); }
+
+  uint64_t getBlockedWord(int row, int word) const {
+    uint64_t blocked = _grid->getBlockedWord(row, word);
+    return _overlay ? blocked & ~_overlay->getBlockedWord(row, word) : blocked;
+  }
+
+  bool isValid(int row, int col) const { return _grid->isValid(row, col); }
+
+  bool isWalkable(int row, int col) const {
+    return isValid(row, col) &&
+           ((getBlockedWord(row, col >> 6) >> (col & 63)) & 1) == 0;
+  }
+
+ private:
+  const BattleGrid* _grid;
+  const BattleGrid* _overlay;
+};
+
+#endif  // __BATTLE_GRID_H__
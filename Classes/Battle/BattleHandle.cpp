@@ -0,0 +1,41 @@
+#include "Battle/BattleHandle.h"
+
+BattleHandle BattleHandleRegistry::allocate() {
+  int index;
+  if (!_freeSlots.empty()) {
+    index = _freeSlots.back();
+    _freeSlots.pop_back();
+  } else {
+    index = capacity();
+    _generations.push_back(0);
+    _alive.push_back(0);
+  }
+  _alive[index] = 1;
+  return BattleHandle::make(index, _generations[index]);
+}
+
+void BattleHandleRegistry::release(BattleHandle handle) {
+  if (!isValid(handle)) {
+    return;
+  }
+  int index = handle.index();
+  _alive[index] = 0;
+  _generations[index] =
+      (_generations[index] + 1) & BattleHandle::GENERATION_MASK;
+  _freeSlots.push_back(index);
+}
+
+void BattleHandleRegistry::clear() {
+  // 保留代数，旧句柄在槽位重新分配后依然无效
+  for (int index = 0; index < capacity(); ++index) {
+    if (_alive[index]) {
+      _alive[index] = 0;
+      _generations[index] =
+          (_generations[index] + 1) & BattleHandle::GENERATION_MASK;
+    }
+  }
+  _freeSlots.clear();
+  for (int index = capacity() - 1; index >= 0; --index) {
+    _freeSlots.push_back(index);
+  }
+}
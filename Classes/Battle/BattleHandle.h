@@ -0,0 +1,96 @@
+#ifndef __BATTLE_HANDLE_H__
+#define __BATTLE_HANDLE_H__
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * 战斗实体句柄
+ * 32 位整数：低 20 位为槽位下标，高 12 位为代数。
+ * 槽位回收时代数加一，之前发出的句柄随之失效，
+ * 因此引用其他实体时保存句柄，槽位被复用后也不会指向新实体
+ */
+class BattleHandle {
+ public:
+  static const int INDEX_BITS = 20;
+  static const uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;
+  static const uint32_t GENERATION_MASK = (1u << (32 - INDEX_BITS)) - 1;
+
+  BattleHandle() : _value(NULL_VALUE) {}
+
+  static BattleHandle make(int index, uint32_t generation) {
+    return BattleHandle(((generation & GENERATION_MASK) << INDEX_BITS) |
+                        (static_cast<uint32_t>(index) & INDEX_MASK));
+  }
+
+  bool isNull() const { return _value == NULL_VALUE; }
+  int index() const { return static_cast<int>(_value & INDEX_MASK); }
+  uint32_t generation() const { return _value >> INDEX_BITS; }
+  uint32_t value() const { return _value; }
+
+  bool operator==(const BattleHandle& other) const {
+    return _value == other._value;
+  }
+  bool operator!=(const BattleHandle& other) const {
+    return _value != other._value;
+  }
+
+ private:
+  static const uint32_t NULL_VALUE = 0xFFFFFFFFu;
+
+  explicit BattleHandle(uint32_t value) : _value(value) {}
+
+  uint32_t _value;
+};
+
+/**
+ * 句柄分配表
+ * 管理一类实体的槽位：分配时优先复用已释放的槽位，
+ * 释放时代数加一；句柄有效性检查为 O(1)
+ */
+class BattleHandleRegistry {
+ public:
+  /**
+   * 分配一个槽位
+   * @return 新句柄，index() 等于 capacity() 时表示新增的槽位
+   */
+  BattleHandle allocate();
+
+  /**
+   * 释放句柄对应的槽位（句柄无效时忽略）
+   */
+  void release(BattleHandle handle);
+
+  /**
+   * 句柄是否仍指向存活的实体
+   */
+  bool isValid(BattleHandle handle) const {
+    int index = handle.index();
+    return !handle.isNull() && index < capacity() && _alive[index] &&
+           _generations[index] == handle.generation();
+  }
+
+  /**
+   * 槽位当前的句柄（槽位未被占用时返回空句柄）
+   */
+  BattleHandle handleAt(int index) const {
+    if (index < 0 || index >= capacity() || !_alive[index]) {
+      return BattleHandle();
+    }
+    return BattleHandle::make(index, _generations[index]);
+  }
+
+  int capacity() const { return static_cast<int>(_generations.size()); }
+
+  /**
+   * 释放全部槽位，之前发出的句柄全部失效
+   */
+  void clear();
+
+ private:
+  std::vector<uint32_t> _generations;  // 每个槽位的当前代数
+  std::vector<uint8_t> _alive;         // 槽位是否被占用
+  std::vector<int> _freeSlots;         // 可复用的槽位
+};
+
+#endif  // __BATTLE_HANDLE_H__
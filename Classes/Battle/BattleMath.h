@@ -0,0 +1,128 @@
+#ifndef __BATTLE_MATH_H__
+#define __BATTLE_MATH_H__
+
+#include <cfloat>
+#include <cmath>
+
+#include "Battle/BattleFixed.h"
+
+/**
+ * 战斗核心的数值类型
+ * 定义 COC_FIXED_POINT 时使用 Q16.16 定点数，保证同一份战斗记录在所有
+ * 平台上的结果逐位一致；否则使用 float。
+ * 与引擎交互（渲染、日志）时用 static_cast<float> 转换，两种模式下都适用
+ */
+#ifdef COC_FIXED_POINT
+typedef BattleFixed BattleReal;
+#else
+typedef float BattleReal;
+#endif
+
+/**
+ * 战斗数值工具函数
+ * 两种数值模式下接口一致，战斗核心中不直接调用 std::sqrt 等浮点函数
+ */
+class BattleMath {
+ public:
+  static BattleReal sqrt(BattleReal value) {
+#ifdef COC_FIXED_POINT
+    return BattleFixed::sqrt(value);
+#else
+    return std::sqrt(value);
+#endif
+  }
+
+  /**
+   * 向量 (x, y) 的长度
+   */
+  static BattleReal length(BattleReal x, BattleReal y) {
+#ifdef COC_FIXED_POINT
+    return BattleFixed::hypot(x, y);
+#else
+    return std::sqrt(x * x + y * y);
+#endif
+  }
+
+  /**
+   * 四舍五入到整数
+   */
+  static int round(BattleReal value) {
+#ifdef COC_FIXED_POINT
+    return (value.raw() + BattleFixed::ONE / 2) >> BattleFixed::FRACTION_BITS;
+#else
+    return static_cast<int>(std::round(value));
+#endif
+  }
+
+  /**
+   * 最大值，用于最近距离搜索的初始值
+   */
+  static BattleReal maxValue() {
+#ifdef COC_FIXED_POINT
+    return BattleFixed::max();
+#else
+    return FLT_MAX;
+#endif
+  }
+};
+
+/**
+ * 战斗核心使用的二维向量
+ * 语义与 cocos2d::Vec2 保持一致（地图层坐标，单位像素），但不依赖引擎
+ */
+struct BattleVec2 {
+  BattleReal x;
+  BattleReal y;
+
+  BattleVec2() : x(0), y(0) {}
+  BattleVec2(BattleReal xx, BattleReal yy) : x(xx), y(yy) {}
+
+  BattleVec2 operator+(const BattleVec2& v) const {
+    return BattleVec2(x + v.x, y + v.y);
+  }
+  BattleVec2 operator-(const BattleVec2& v) const {
+    return BattleVec2(x - v.x, y - v.y);
+  }
+  BattleVec2 operator*(BattleReal s) const {
+    return BattleVec2(x * s, y * s);
+  }
+  BattleVec2& operator+=(const BattleVec2& v) {
+    x += v.x;
+    y += v.y;
+    return *this;
+  }
+
+  BattleReal length() const { return BattleMath::length(x, y); }
+
+  BattleReal distance(const BattleVec2& v) const {
+    return (*this - v).length();
+  }
+
+  /**
+   * 归一化（零向量保持不变，与 Vec2::normalize 一致）
+   */
+  void normalize() {
+#ifdef COC_FIXED_POINT
+    BattleReal n = length();
+    if (n == 0) {
+      return;
+    }
+    x /= n;
+    y /= n;
+#else
+    float n = x * x + y * y;
+    if (n == 1.0f) {
+      return;
+    }
+    n = std::sqrt(n);
+    if (n < 2e-37f) {
+      return;
+    }
+    n = 1.0f / n;
+    x *= n;
+    y *= n;
+#endif
+  }
+};
+
+#endif  // __BATTLE_MATH_H__
@@ -0,0 +1,103 @@
+#include "Battle/BattlePathCache.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "Battle/BattlePathSmoother.h"
+
+namespace {
+void includeCell(BattleGridArea& area, int row, int col) {
+  area.row0 = std::min(area.row0, row);
+  area.col0 = std::min(area.col0, col);
+  area.row1 = std::max(area.row1, row);
+  area.col1 = std::max(area.col1, col);
+}
+}  // namespace
+
+const size_t BattlePathCache::MAX_ENTRIES;
+
+uint64_t BattlePathCache::makeKey(int startCell, int building,
+                                  bool passWalls, int attackRange) {
+  // 建筑 20 位，攻击范围 12 位，起点子网格 31 位，是否穿墙 1 位
+  uint64_t range = std::min(std::max(attackRange, 0), 0xFFF);
+  return (static_cast<uint64_t>(static_cast<uint32_t>(building)) << 44) |
+         (range << 32) |
+         (static_cast<uint64_t>(static_cast<uint32_t>(startCell)) << 1) |
+         (passWalls ? 1u : 0u);
+}
+
+const std::vector<BattleVec2>* BattlePathCache::find(
+    int startCell, int building, bool passWalls, int attackRange,
+    unsigned gridVersion) const {
+  if (gridVersion != _version) {
+    return nullptr;
+  }
+  auto it = _entries.find(
+      makeKey(startCell, building, passWalls, attackRange));
+  return it == _entries.end() ? nullptr : &it->second.path;
+}
+
+void BattlePathCache::store(int startCell, int building, bool passWalls,
+                            int attackRange, unsigned gridVersion,
+                            const BattleVec2& start,
+                            const std::vector<BattleVec2>& path,
+                            const BattleProjection& projection,
+                            const BattleGridArea& goalArea) {
+  if (gridVersion != _version || _gridSize != projection.gridSize ||
+      _entries.size() >= MAX_ENTRIES) {
+    clear();
+    _version = gridVersion;
+    _gridSize = projection.gridSize;
+  }
+
+  Entry& entry =
+      _entries[makeKey(startCell, building, passWalls, attackRange)];
+  entry.building = building;
+  entry.path = path;
+  entry.goalArea = goalArea;
+  entry.cells.clear();
+  BattleVec2 from = start;
+  for (const BattleVec2& point : path) {
+    BattlePathSmoother::traceCells(from, point, projection, entry.cells);
+    from = point;
+  }
+  std::sort(entry.cells.begin(), entry.cells.end());
+  entry.cells.erase(std::unique(entry.cells.begin(), entry.cells.end()),
+                    entry.cells.end());
+
+  // 第一段线段从 start 开始，cells 已包含起点所在的网格
+  entry.bounds = goalArea;
+  for (int cell : entry.cells) {
+    includeCell(entry.bounds, cell / _gridSize, cell % _gridSize);
+  }
+}
+
+void BattlePathCache::invalidate(const BattleGridArea& area, bool blocked,
+                                 unsigned previousVersion, unsigned version) {
+  if (previousVersion != _version) {
+    clear();
+    _version = version;
+    return;
+  }
+
+  for (auto it = _entries.begin(); it != _entries.end();) {
+    const Entry& entry = it->second;
+    bool hit = blocked ? entry.goalArea.intersects(area)
+                       : entry.bounds.intersects(area);
+    for (size_t i = 0; !hit && i < entry.cells.size(); ++i) {
+      hit = area.contains(entry.cells[i] / _gridSize,
+                          entry.cells[i] % _gridSize);
+    }
+    it = hit ? _entries.erase(it) : std::next(it);
+  }
+  _version = version;
+}
+
+void BattlePathCache::eraseBuilding(int building) {
+  for (auto it = _entries.begin(); it != _entries.end();) {
+    it = (it->second.building == building) ? _entries.erase(it)
+                                           : std::next(it);
+  }
+}
+
+void BattlePathCache::clear() { _entries.clear(); }
@@ -0,0 +1,82 @@
+#ifndef __BATTLE_PATH_CACHE_H__
+#define __BATTLE_PATH_CACHE_H__
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Battle/BattleGrid.h"
+
+/**
+ * 寻路结果缓存
+ * 键为（起点子网格, 目标建筑, 是否穿墙, 攻击范围），缓存与一个网格版本
+ * 对应。
+ * 每条记录保存路径经过的网格、目标周围的攻击位范围以及二者连同起点的
+ * 包围盒；网格变化时只删除受影响的记录，其余记录随网格版本继续有效
+ */
+class BattlePathCache {
+ public:
+  static const size_t MAX_ENTRIES = 4096;  // 超过后清空，限制内存
+
+  /**
+   * 查找缓存的路径
+   * @param startCell 起点所在子网格（row * size + col）
+   * @param attackRange 攻击范围（取整后的像素数），决定攻击位
+   * @param gridVersion 当前网格版本，与缓存版本不同时视为未命中
+   * @return 未命中时返回 nullptr
+   */
+  const std::vector<BattleVec2>* find(int startCell, int building,
+                                      bool passWalls, int attackRange,
+                                      unsigned gridVersion) const;
+
+  /**
+   * 保存路径
+   * 路径点之间按直线行走，记录从 start 起每段线段经过的所有网格
+   * @param start 计算路径时的起点
+   * @param goalArea 目标周围可能作为攻击位的网格范围
+   *                 （BattleGoalSet::getReachArea）
+   */
+  void store(int startCell, int building, bool passWalls, int attackRange,
+             unsigned gridVersion, const BattleVec2& start,
+             const std::vector<BattleVec2>& path,
+             const BattleProjection& projection,
+             const BattleGridArea& goalArea);
+
+  /**
+   * 网格中 area 区域的阻挡状态发生变化
+   * 缓存版本等于 previousVersion 时删除受影响的记录，其余记录更新到
+   * version；否则（中间漏掉了变化）清空缓存。
+   * 区域变为阻挡时，路径或攻击位范围与区域相交的记录受影响；区域变为
+   * 可通行时可能出现更短的路线，包围盒与区域相交的记录都受影响
+   * @param blocked 区域变化后是否阻挡
+   */
+  void invalidate(const BattleGridArea& area, bool blocked,
+                  unsigned previousVersion, unsigned version);
+
+  /**
+   * 删除以该建筑为目标的记录
+   */
+  void eraseBuilding(int building);
+
+  void clear();
+
+  size_t size() const { return _entries.size(); }
+
+ private:
+  struct Entry {
+    int building = -1;
+    std::vector<BattleVec2> path;
+    std::vector<int> cells;  // 路径经过的网格（row * size + col）
+    BattleGridArea goalArea;
+    BattleGridArea bounds;  // 起点、路径网格和攻击位范围的包围盒
+  };
+
+  static uint64_t makeKey(int startCell, int building, bool passWalls,
+                          int attackRange);
+
+  std::unordered_map<uint64_t, Entry> _entries;
+  unsigned _version = 0;
+  int _gridSize = 0;
+};
+
+#endif  // __BATTLE_PATH_CACHE_H__
@@ -0,0 +1,713 @@
+#include "Battle/BattlePathFinder.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+
+namespace {
+// 8方向移动偏移，直线代价10，对角线14
+const int kDr[] = {0, 0, 1, -1, 1, 1, -1, -1};
+const int kDc[] = {1, -1, 0, 0, 1, -1, 1, -1};
+const int kCost[] = {10, 10, 10, 10, 14, 14, 14, 14};
+
+const int MAX_STEPS = 10000;  // 限制最大搜索步数，防止卡死
+
+// 当前使用的寻路算法，所有线程共用
+std::atomic<int> gAlgorithm(
+    static_cast<int>(BattlePathFinder::Algorithm::ASTAR));
+
+const int NOT_IN_HEAP = -1;
+const int CLOSED = -2;
+
+// 一个子网格的搜索状态
+// search 等于当前搜索编号时其余字段才有效，开始新的搜索时不需要清空数组
+struct SearchCell {
+  uint32_t search = 0;
+  int g = 0;
+  int parent = -1;
+  int heapIndex = NOT_IN_HEAP;  // 在 open 堆中的位置，或 CLOSED
+};
+
+// open 堆中的元素，f 与下标放在一起，比较时不访问 SearchCell
+struct HeapEntry {
+  int f;
+  int cell;
+};
+
+/**
+ * 可复用的搜索状态
+ * 按子网格下标索引的平坦数组 + 按 f 排序、支持降低键值的索引二叉堆，
+ * 以及把子网格坐标映射到（带一圈阻挡边框的）大网格的查找表
+ */
+class SearchArena {
+ public:
+  /**
+   * 开始一次搜索
+   * Grid 为 BattleGrid 或 BattleGridView，按字读取阻挡位
+   * @param size 子网格边长（grid.getSize() * precision）
+   */
+  template <typename Grid>
+  void begin(const Grid& grid, int precision, int size) {
+    int cellCount = size * size;
+    if (static_cast<int>(_cells.size()) < cellCount) {
+      _cells.resize(cellCount);
+      _targets.resize(cellCount, 0);
+    }
+    _heap.clear();
+    _goalSet = nullptr;
+    expanded = 0;
+
+    // 编号回绕时清空旧标记，避免与很久以前的搜索混淆
+    if (++_search == 0) {
+      std::fill(_cells.begin(), _cells.end(), SearchCell());
+      std::fill(_targets.begin(), _targets.end(), 0);
+      _search = 1;
+    }
+
+    // 大网格外围加一圈阻挡，子网格坐标 -1 和 size 都映射到边框上。
+    // 按字读取阻挡位，展开为字节表后每次查询只需一次读取
+    const int coarse = grid.getSize();
+    const int padded = coarse + 2;
+    _precision = precision;
+    _size = size;
+    _walkable.assign(padded * padded, 0);
+    _coarseTargets.assign(padded * padded, 0);
+    for (int row = 0; row < coarse; ++row) {
+      unsigned char* dest = &_walkable[(row + 1) * padded + 1];
+      for (int col = 0; col < coarse; col += 64) {
+        uint64_t blocked = grid.getBlockedWord(row, col >> 6);
+        for (int bit = 0; bit < 64 && col + bit < coarse; ++bit) {
+          dest[col + bit] = ((blocked >> bit) & 1) == 0;
+        }
+      }
+    }
+    _rowOffset.resize(size + 2);
+    _colOffset.resize(size + 2);
+    for (int i = -1; i <= size; ++i) {
+      int index = (i < 0) ? 0 : (i >= size ? coarse + 1 : i / precision + 1);
+      _rowOffset[i + 1] = index * padded;
+      _colOffset[i + 1] = index;
+    }
+  }
+
+  /**
+   * 子网格是否可通行，r 和 c 的范围为 [-1, size]
+   */
+  bool isWalkable(int r, int c) const {
+    return _walkable[coarseIndex(r, c)] != 0;
+  }
+
+  bool isSeen(int i) const { return _cells[i].search == _search; }
+  bool isClosed(int i) const {
+    return isSeen(i) && _cells[i].heapIndex == CLOSED;
+  }
+  bool isTarget(int i) const {
+    return _goalSet ? _goalSet->contains(i) : _targets[i] == _search;
+  }
+  void close(int i) { _cells[i].heapIndex = CLOSED; }
+  void markTarget(int i) {
+    _targets[i] = _search;
+    _coarseTargets[coarseIndex(i / _size, i % _size)] = 1;
+  }
+
+  /**
+   * 直接使用攻击位集合的位图判断终点（集合在搜索期间必须保持有效）
+   */
+  void useGoalSet(const BattleGoalSet& goals) {
+    _goalSet = &goals;
+    for (int cell : goals.getCells()) {
+      _coarseTargets[coarseIndex(cell / _size, cell % _size)] = 1;
+    }
+  }
+
+  /**
+   * 子网格所在的大格子内是否有有效终点
+   */
+  bool hasCoarseTarget(int r, int c) const {
+    return _coarseTargets[coarseIndex(r, c)] != 0;
+  }
+
+  /**
+   * 子网格坐标 v 所在的大格子沿 d（+1 或 -1）方向的最后一个子网格坐标
+   */
+  int lastInCoarse(int v, int d) const {
+    int coarse = _colOffset[v + 1] - 1;  // 行列的映射相同
+    return d > 0 ? (coarse + 1) * _precision - 1 : coarse * _precision;
+  }
+
+  std::vector<int>& goals() { return _goals; }
+
+  const SearchCell& cell(int i) const { return _cells[i]; }
+
+  int expanded = 0;  // 本次搜索从 open 表取出的节点数
+
+  /**
+   * 首次到达子网格，或找到更短的路径时更新代价
+   */
+  void relax(int i, int g, int f, int parent) {
+    SearchCell& node = _cells[i];
+    if (node.search != _search) {
+      node.search = _search;
+      node.heapIndex = static_cast<int>(_heap.size());
+      _heap.push_back({f, i});
+    }
+    node.g = g;
+    node.parent = parent;
+    _heap[node.heapIndex].f = f;
+    siftUp(node.heapIndex);
+  }
+
+  bool empty() const { return _heap.empty(); }
+
+  int pop() {
+    int top = _heap.front().cell;
+    _cells[top].heapIndex = NOT_IN_HEAP;
+    HeapEntry last = _heap.back();
+    _heap.pop_back();
+    if (!_heap.empty()) {
+      _heap[0] = last;
+      siftDown(0);
+    }
+    return top;
+  }
+
+ private:
+  int coarseIndex(int r, int c) const {
+    return _rowOffset[r + 1] + _colOffset[c + 1];
+  }
+
+  void place(int position, const HeapEntry& entry) {
+    _heap[position] = entry;
+    _cells[entry.cell].heapIndex = position;
+  }
+
+  void siftUp(int position) {
+    HeapEntry entry = _heap[position];
+    while (position > 0) {
+      int parent = (position - 1) / 2;
+      if (entry.f >= _heap[parent].f) {
+        break;
+      }
+      place(position, _heap[parent]);
+      position = parent;
+    }
+    place(position, entry);
+  }
+
+  void siftDown(int position) {
+    HeapEntry entry = _heap[position];
+    const int count = static_cast<int>(_heap.size());
+    while (true) {
+      int child = position * 2 + 1;
+      if (child >= count) {
+        break;
+      }
+      if (child + 1 < count && _heap[child + 1].f < _heap[child].f) {
+        child++;
+      }
+      if (_heap[child].f >= entry.f) {
+        break;
+      }
+      place(position, _heap[child]);
+      position = child;
+    }
+    place(position, entry);
+  }
+
+  std::vector<SearchCell> _cells;
+  std::vector<uint32_t> _targets;  // 等于搜索编号表示为有效终点
+  std::vector<HeapEntry> _heap;
+  std::vector<int> _goals;
+  const BattleGoalSet* _goalSet = nullptr;  // 不为空时代替 _targets
+  uint32_t _search = 0;
+
+  std::vector<unsigned char> _walkable;       // 带边框的大网格可通行表
+  std::vector<unsigned char> _coarseTargets;  // 大网格内是否有有效终点
+  std::vector<int> _rowOffset;                // 子网格行 -> 大网格行偏移
+  std::vector<int> _colOffset;                // 子网格列 -> 大网格列
+  int _precision = 1;
+  int _size = 0;
+};
+
+// 每个线程一份搜索状态，批量模拟时多线程寻路互不干扰
+SearchArena& threadArena() {
+  thread_local SearchArena arena;
+  return arena;
+}
+
+int sign(int value) { return (value > 0) - (value < 0); }
+
+// 两个子网格之间沿直线或对角线移动的代价
+int octileCost(int dr, int dc) {
+  dr = std::abs(dr);
+  dc = std::abs(dc);
+  return std::min(dr, dc) * 14 + std::abs(dr - dc) * 10;
+}
+
+/**
+ * 全部有效终点的包围盒
+ * 启发式函数取到包围盒的八方向距离：不超过到任何一个终点的实际代价，
+ * 并且满足三角不等式，第一个从 open 表取出的终点即代价最小的终点
+ */
+struct GoalBounds {
+  int row0 = 0;
+  int col0 = 0;
+  int row1 = -1;
+  int col1 = -1;
+
+  GoalBounds(const std::vector<int>& cells, int size) {
+    for (size_t i = 0; i < cells.size(); ++i) {
+      int row = cells[i] / size;
+      int col = cells[i] % size;
+      if (i == 0) {
+        row0 = row1 = row;
+        col0 = col1 = col;
+        continue;
+      }
+      row0 = std::min(row0, row);
+      col0 = std::min(col0, col);
+      row1 = std::max(row1, row);
+      col1 = std::max(col1, col);
+    }
+  }
+
+  int estimate(int row, int col) const {
+    int dr = row < row0 ? row0 - row : std::max(row - row1, 0);
+    int dc = col < col0 ? col0 - col : std::max(col - col1, 0);
+    return octileCost(dr, dc);
+  }
+};
+
+/**
+ * 从 (r, c) 沿 (dr, dc) 方向跳跃
+ * 遇到有效终点、强制邻居（障碍物旁边出现的捷径）或者对角线方向上
+ * 直线跳跃能找到跳点时停下；所有移动都允许斜穿障碍物的角
+ * @return 跳点的子网格下标，碰到障碍物或地图边界时返回 -1
+ */
+int jump(const SearchArena& arena, int size, int r, int c, int dr, int dc) {
+  while (true) {
+    r += dr;
+    c += dc;
+    if (!arena.isWalkable(r, c)) {
+      return -1;
+    }
+    int cell = r * size + c;
+    if (arena.isTarget(cell)) {
+      return cell;
+    }
+
+    if (dr != 0 && dc != 0) {
+      if ((arena.isWalkable(r + dr, c - dc) && !arena.isWalkable(r, c - dc)) ||
+          (arena.isWalkable(r - dr, c + dc) && !arena.isWalkable(r - dr, c))) {
+        return cell;
+      }
+      // 对角线上的每一步都先沿两个分量方向直线跳跃
+      if (jump(arena, size, r, c, dr, 0) >= 0 ||
+          jump(arena, size, r, c, 0, dc) >= 0) {
+        return cell;
+      }
+    } else if (dr != 0) {
+      // 大格子内的子网格可通行性相同，不会出现强制邻居；
+      // 大格子内没有终点时直接前进到它在移动方向上的最后一个子网格
+      if (!arena.hasCoarseTarget(r, c)) {
+        r = arena.lastInCoarse(r, dr);
+        cell = r * size + c;
+      }
+      if ((arena.isWalkable(r + dr, c + 1) && !arena.isWalkable(r, c + 1)) ||
+          (arena.isWalkable(r + dr, c - 1) && !arena.isWalkable(r, c - 1))) {
+        return cell;
+      }
+    } else {
+      if (!arena.hasCoarseTarget(r, c)) {
+        c = arena.lastInCoarse(c, dc);
+        cell = r * size + c;
+      }
+      if ((arena.isWalkable(r + 1, c + dc) && !arena.isWalkable(r + 1, c)) ||
+          (arena.isWalkable(r - 1, c + dc) && !arena.isWalkable(r - 1, c))) {
+        return cell;
+      }
+    }
+  }
+}
+
+/**
+ * 按到达方向裁剪后需要搜索的方向
+ * 起点没有父节点，搜索全部 8 个方向
+ * @return 方向数量，方向写入 dirs（每个方向两个分量）
+ */
+int prunedDirections(const SearchArena& arena, int r, int c, int dr, int dc,
+                     int dirs[16]) {
+  int count = 0;
+  auto add = [&](int ddr, int ddc) {
+    dirs[count * 2] = ddr;
+    dirs[count * 2 + 1] = ddc;
+    count++;
+  };
+
+  if (dr == 0 && dc == 0) {
+    for (int i = 0; i < 8; ++i) {
+      add(kDr[i], kDc[i]);
+    }
+  } else if (dr != 0 && dc != 0) {
+    add(dr, 0);
+    add(0, dc);
+    add(dr, dc);
+    if (!arena.isWalkable(r, c - dc)) {
+      add(dr, -dc);
+    }
+    if (!arena.isWalkable(r - dr, c)) {
+      add(-dr, dc);
+    }
+  } else if (dr != 0) {
+    add(dr, 0);
+    if (!arena.isWalkable(r, c + 1)) {
+      add(dr, 1);
+    }
+    if (!arena.isWalkable(r, c - 1)) {
+      add(dr, -1);
+    }
+  } else {
+    add(0, dc);
+    if (!arena.isWalkable(r + 1, c)) {
+      add(1, dc);
+    }
+    if (!arena.isWalkable(r - 1, c)) {
+      add(-1, dc);
+    }
+  }
+  return count;
+}
+}  // namespace
+
+void BattlePathFinder::setAlgorithm(Algorithm algorithm) {
+  gAlgorithm.store(static_cast<int>(algorithm));
+}
+
+BattlePathFinder::Algorithm BattlePathFinder::getAlgorithm() {
+  return static_cast<Algorithm>(gAlgorithm.load());
+}
+
+int BattlePathFinder::getLastExpandedCount() { return threadArena().expanded; }
+
+namespace {
+template <typename Grid>
+bool collectGoalCells(int eRow, int eCol, const Grid& grid, int precision,
+                      std::vector<int>& cells) {
+  cells.clear();
+  const int size = grid.getSize() * precision;
+  auto isWalkablePrecise = [&](int r, int c) -> bool {
+    return r >= 0 && r < size && c >= 0 && c < size &&
+           grid.isWalkable(r / precision, c / precision);
+  };
+
+  if (isWalkablePrecise(eRow, eCol)) {
+    cells.push_back(eRow * size + eCol);
+    return true;
+  }
+
+  // 如果终点不可通行（例如是建筑），寻找周围所有可通行点作为潜在目标
+  // 策略：一旦找到至少一个可通行点，再多搜索一圈（为了覆盖角落），然后停止
+  int radius = 1;
+  while (radius <= 5 * precision) {
+    for (int r = eRow - radius; r <= eRow + radius; ++r) {
+      for (int c = eCol - radius; c <= eCol + radius; ++c) {
+        // 只检查边缘
+        if (std::abs(r - eRow) == radius || std::abs(c - eCol) == radius) {
+          if (isWalkablePrecise(r, c)) {
+            cells.push_back(r * size + c);
+          }
+        }
+      }
+    }
+    if (!cells.empty() && radius > 2 * precision) {
+      break;
+    }
+    radius++;
+  }
+  return !cells.empty();
+}
+
+// 各方向代价均匀，每一步只有移动代价，可以使用 JPS
+struct UniformCost {
+  static const bool UNIFORM = true;
+  int operator()(int, int) const { return 0; }
+};
+
+// 破墙寻路：从其他大格子进入墙壁所在的大格子时，加上拆掉这段墙的代价
+struct WallCost {
+  static const bool UNIFORM = false;
+  const BattleGrid* walls;          // 阻挡位表示有墙
+  const std::vector<int>* penalty;  // 按大格子下标
+  int precision;
+  int size;  // 子网格边长
+
+  int operator()(int from, int to) const {
+    int row = to / size / precision;
+    int col = to % size / precision;
+    if (walls->isWalkable(row, col) ||
+        (from / size / precision == row && from % size / precision == col)) {
+      return 0;
+    }
+    return (*penalty)[row * walls->getSize() + col];
+  }
+};
+
+template <typename Grid, typename StepCost>
+std::vector<BattleVec2> searchPath(const BattleVec2& startPos,
+                                   const BattleVec2& endPos,
+                                   const BattleProjection& projection,
+                                   const Grid& grid, int precision,
+                                   const StepCost& stepCost,
+                                   const BattleGoalSet* goalSet,
+                                   int maxSteps) {
+  BattleReal startRow, startCol, endRow, endCol;
+
+  // 转换坐标
+  if (!projection.screenToGrid(startPos, startRow, startCol) ||
+      !projection.screenToGrid(endPos, endRow, endCol)) {
+    return {};
+  }
+
+  // 使用精度倍增坐标
+  int sRow = BattleMath::round(startRow * precision);
+  int sCol = BattleMath::round(startCol * precision);
+  int eRow = BattleMath::round(endRow * precision);
+  int eCol = BattleMath::round(endCol * precision);
+
+  // 如果起点和终点相同，直接返回终点
+  if (sRow == eRow && sCol == eCol) {
+    return {endPos};
+  }
+
+  // 一个大格子被分为 precision*precision 个小格子，
+  // 只要大格子不可通行，所有小格子都不可通行
+  const int size = grid.getSize() * precision;
+  if (size <= 0) {
+    return {};
+  }
+  SearchArena& arena = threadArena();
+  arena.begin(grid, precision, size);
+
+  // 起点可能恰好位于地图边界上
+  sRow = std::min(std::max(sRow, 0), size - 1);
+  sCol = std::min(std::max(sCol, 0), size - 1);
+
+  // 标记有效终点（如果终点不可通行，则标记所有可能的替代终点）
+  if (goalSet) {
+    if (goalSet->getSize() != size || goalSet->empty()) {
+      return {};
+    }
+    arena.useGoalSet(*goalSet);
+  } else {
+    std::vector<int>& goals = arena.goals();
+    if (!collectGoalCells(eRow, eCol, grid, precision, goals)) {
+      return {};
+    }
+    for (int goal : goals) {
+      arena.markTarget(goal);
+    }
+  }
+
+  GoalBounds bounds(goalSet ? goalSet->getCells() : arena.goals(), size);
+  int start = sRow * size + sCol;
+  arena.relax(start, 0, bounds.estimate(sRow, sCol), -1);
+
+  // 跳点搜索依赖均匀的代价，带权重的搜索总是逐个子网格展开
+  const bool jps =
+      StepCost::UNIFORM &&
+      BattlePathFinder::getAlgorithm() == BattlePathFinder::Algorithm::JPS;
+  int dest = -1;
+  while (!arena.empty()) {
+    if (++arena.expanded > maxSteps) {
+      break;
+    }
+    int current = arena.pop();
+    arena.close(current);
+
+    // 第一个被从 open 表取出的有效终点即路径代价最小的攻击位
+    if (arena.isTarget(current)) {
+      dest = current;
+      break;
+    }
+
+    int row = current / size;
+    int col = current % size;
+    int g = arena.cell(current).g;
+
+    if (jps) {
+      // 只沿裁剪后的方向跳跃，跳点之间的子网格不进入 open 表
+      int parent = arena.cell(current).parent;
+      int dr = parent < 0 ? 0 : sign(row - parent / size);
+      int dc = parent < 0 ? 0 : sign(col - parent % size);
+      int dirs[16];
+      int dirCount = prunedDirections(arena, row, col, dr, dc, dirs);
+      for (int i = 0; i < dirCount; ++i) {
+        int neighbor =
+            jump(arena, size, row, col, dirs[i * 2], dirs[i * 2 + 1]);
+        if (neighbor < 0 || arena.isClosed(neighbor)) {
+          continue;
+        }
+        int nr = neighbor / size;
+        int nc = neighbor % size;
+        int newG = g + octileCost(nr - row, nc - col);
+        if (arena.isSeen(neighbor) && newG >= arena.cell(neighbor).g) {
+          continue;
+        }
+        arena.relax(neighbor, newG, newG + bounds.estimate(nr, nc), current);
+      }
+      continue;
+    }
+
+    // 遍历邻居
+    for (int i = 0; i < 8; ++i) {
+      int nr = row + kDr[i];
+      int nc = col + kDc[i];
+      // 当前子网格在范围内，邻居最多越界一格，由边框处理
+      if (!arena.isWalkable(nr, nc)) {
+        continue;
+      }
+
+      int neighbor = nr * size + nc;
+      if (arena.isClosed(neighbor)) {
+        continue;
+      }
+
+      int newG = g + kCost[i] + stepCost(current, neighbor);
+      if (arena.isSeen(neighbor) && newG >= arena.cell(neighbor).g) {
+        continue;
+      }
+      arena.relax(neighbor, newG, newG + bounds.estimate(nr, nc), current);
+    }
+  }
+
+  std::vector<BattleVec2> path;
+  if (dest >= 0) {
+    // 回溯路径，路径点位于子网格的中心，而不是顶点。
+    // JPS 的父节点是上一个跳点，中间沿直线或对角线逐格补齐
+    auto addPoint = [&](int r, int c) {
+      BattleReal row = (BattleReal(r) + 0.5f) / precision;
+      BattleReal col = (BattleReal(c) + 0.5f) / precision;
+      path.push_back(projection.gridToScene(row, col));
+    };
+    int r = dest / size;
+    int c = dest % size;
+    addPoint(r, c);
+    for (int node = arena.cell(dest).parent; node >= 0;
+         node = arena.cell(node).parent) {
+      int pr = node / size;
+      int pc = node % size;
+      int dr = sign(pr - r);
+      int dc = sign(pc - c);
+      while (r != pr || c != pc) {
+        r += dr;
+        c += dc;
+        addPoint(r, c);
+      }
+    }
+    // 路径是反向的，需要翻转
+    std::reverse(path.begin(), path.end());
+
+    // 移除起点（因为已经在起点了）
+    // 如果路径只包含一个点（起点即终点），保留它，
+    // 否则空路径会被调用者误判为"寻路失败"
+    if (path.size() > 1) {
+      path.erase(path.begin());
+    }
+  }
+  return path;
+}
+}  // namespace
+
+bool BattlePathFinder::findGoalCells(int eRow, int eCol,
+                                     const BattleGrid& grid, int precision,
+                                     std::vector<int>& cells) {
+  return collectGoalCells(eRow, eCol, grid, precision, cells);
+}
+
+bool BattlePathFinder::findGoalCells(int eRow, int eCol,
+                                     const BattleGridView& grid, int precision,
+                                     std::vector<int>& cells) {
+  return collectGoalCells(eRow, eCol, grid, precision, cells);
+}
+
+std::vector<BattleVec2> BattlePathFinder::findPath(
+    const BattleVec2& startPos, const BattleVec2& endPos,
+    const BattleProjection& projection, const BattleGrid& grid,
+    int precision) {
+  return searchPath(startPos, endPos, projection, grid, precision,
+                    UniformCost(), nullptr, MAX_STEPS);
+}
+
+std::vector<BattleVec2> BattlePathFinder::findPath(
+    const BattleVec2& startPos, const BattleVec2& endPos,
+    const BattleProjection& projection, const BattleGridView& grid,
+    int precision) {
+  return searchPath(startPos, endPos, projection, grid, precision,
+                    UniformCost(), nullptr, MAX_STEPS);
+}
+
+std::vector<BattleVec2> BattlePathFinder::findPath(
+    const BattleVec2& startPos, const BattleVec2& endPos,
+    const BattleGoalSet& goals, const BattleProjection& projection,
+    const BattleGrid& grid) {
+  return searchPath(startPos, endPos, projection, grid, goals.getPrecision(),
+                    UniformCost(), &goals, MAX_STEPS);
+}
+
+std::vector<BattleVec2> BattlePathFinder::findPath(
+    const BattleVec2& startPos, const BattleVec2& endPos,
+    const BattleGoalSet& goals, const BattleProjection& projection,
+    const BattleGridView& grid) {
+  return searchPath(startPos, endPos, projection, grid, goals.getPrecision(),
+                    UniformCost(), &goals, MAX_STEPS);
+}
+
+std::vector<BattleVec2> BattlePathFinder::findBreachPath(
+    const BattleVec2& startPos, const BattleVec2& endPos,
+    const BattleProjection& projection, const BattleGrid& grid,
+    const BattleGrid& walls, const std::vector<int>& wallPenalty,
+    int precision, int& firstWall) {
+  firstWall = -1;
+  WallCost cost;
+  cost.walls = &walls;
+  cost.penalty = &wallPenalty;
+  cost.precision = precision;
+  cost.size = grid.getSize() * precision;
+  // 破墙搜索找不到路线时士兵没有别的办法，步数上限随地图大小放宽，
+  // 大地图上也能展开全部子网格
+  int maxSteps = std::max(MAX_STEPS, cost.size * cost.size);
+  std::vector<BattleVec2> path =
+      searchPath(startPos, endPos, projection, BattleGridView(grid, &walls),
+                 precision, cost, nullptr, maxSteps);
+
+  // 路径上第一个位于墙壁中的点
+  for (const BattleVec2& point : path) {
+    BattleReal row, col;
+    if (!projection.screenToGrid(point, row, col)) {
+      continue;
+    }
+    int r = static_cast<int>(row);
+    int c = static_cast<int>(col);
+    if (walls.isValid(r, c) && !walls.isWalkable(r, c)) {
+      firstWall = r * walls.getSize() + c;
+      break;
+    }
+  }
+  return path;
+}
+
+std::vector<BattleVec2> BattlePathFinder::findPath(
+    const BattleVec2& startPos, const BattleVec2& endPos,
+    const BattleProjection& projection,
+    const std::function<bool(int, int)>& isWalkable, int precision) {
+  BattleGrid grid(projection.gridSize);
+  for (int row = 0; row < projection.gridSize; ++row) {
+    for (int col = 0; col < projection.gridSize; ++col) {
+      if (!isWalkable(row, col)) {
+        grid.setArea(row, col, 1, true);
+      }
+    }
+  }
+  return findPath(startPos, endPos, projection, grid, precision);
+}
@@ -0,0 +1,120 @@
+#ifndef __BATTLE_PATH_FINDER_H__
+#define __BATTLE_PATH_FINDER_H__
+
+#include <functional>
+#include <vector>
+
+#include "Battle/BattleGoalSet.h"
+#include "Battle/BattleGrid.h"
+
+/**
+ * 战斗核心寻路器
+ * 实现 A* 寻路算法，不依赖 cocos2d（PathFinder 为其引擎侧包装）。
+ * 搜索状态保存在按子网格下标索引的平坦数组中，open 表为支持降低键值的
+ * 索引二叉堆；这些数组由每个线程各自持有并在多次寻路之间复用，
+ * 寻路过程中不分配内存。
+ * BattleGrid 和叠加了覆盖层的 BattleGridView 共用同一份按网格类型
+ * 实例化的实现，开始搜索时按字读取阻挡位。
+ * 网格上各方向代价均匀，可以切换为跳点搜索（JPS）：open 表中只保存
+ * 障碍物拐角处的跳点，展开的节点数远少于 A*，返回的路径格式相同
+ */
+class BattlePathFinder {
+ public:
+  /**
+   * 寻路算法
+   */
+  enum class Algorithm {
+    ASTAR,  // 逐个子网格展开
+    JPS     // 跳点搜索
+  };
+
+  /**
+   * 设置之后所有线程的寻路使用的算法，默认为 ASTAR
+   */
+  static void setAlgorithm(Algorithm algorithm);
+  static Algorithm getAlgorithm();
+
+  /**
+   * 当前线程最近一次寻路从 open 表取出的节点数（用于性能对比）
+   */
+  static int getLastExpandedCount();
+
+  /**
+   * 寻找路径
+   * @param startPos 起始地图层坐标
+   * @param endPos 终点地图层坐标
+   * @param projection 网格投影参数
+   * @param grid 可通行网格，越界视为不可通行
+   * @param precision 精度倍数，每个网格被划分为 precision*precision 个子网格
+   * @return 路径点列表（地图层坐标），如果找不到路径返回空列表
+   */
+  static std::vector<BattleVec2> findPath(const BattleVec2& startPos,
+                                          const BattleVec2& endPos,
+                                          const BattleProjection& projection,
+                                          const BattleGrid& grid,
+                                          int precision = 2);
+  static std::vector<BattleVec2> findPath(const BattleVec2& startPos,
+                                          const BattleVec2& endPos,
+                                          const BattleProjection& projection,
+                                          const BattleGridView& grid,
+                                          int precision = 2);
+
+  /**
+   * 以攻击位集合为终点寻找路径，精度与集合相同
+   * 搜索直接按集合的位图判断终点，不再在目标周围逐圈查找
+   * @param endPos 目标位置，只用于启发式函数
+   */
+  static std::vector<BattleVec2> findPath(const BattleVec2& startPos,
+                                          const BattleVec2& endPos,
+                                          const BattleGoalSet& goals,
+                                          const BattleProjection& projection,
+                                          const BattleGrid& grid);
+  static std::vector<BattleVec2> findPath(const BattleVec2& startPos,
+                                          const BattleVec2& endPos,
+                                          const BattleGoalSet& goals,
+                                          const BattleProjection& projection,
+                                          const BattleGridView& grid);
+
+  /**
+   * 允许破墙的寻路（加权 A*）
+   * 墙壁所在的网格可以通过，从其他网格进入时额外加上 wallPenalty 中
+   * 该网格的代价（拆掉这段墙所需的时间折算成的移动代价，直线移动一个
+   * 子网格为 10）。一次搜索同时决定路线和要拆的墙。
+   * 搜索步数上限随地图大小放宽，大地图上也能找到路线
+   * @param grid 可通行网格，墙壁也是阻挡
+   * @param walls 墙壁所在的网格（阻挡位表示有墙）
+   * @param wallPenalty 按网格下标 row * gridSize + col 的额外代价
+   * @param firstWall 输出路径上第一段墙的网格下标，不经过墙时为 -1
+   * @return 路径点列表，格式与 findPath 相同；无法到达时返回空列表
+   */
+  static std::vector<BattleVec2> findBreachPath(
+      const BattleVec2& startPos, const BattleVec2& endPos,
+      const BattleProjection& projection, const BattleGrid& grid,
+      const BattleGrid& walls, const std::vector<int>& wallPenalty,
+      int precision, int& firstWall);
+
+  /**
+   * 寻找路径（通过回调判断可通行，先按 projection.gridSize 生成网格）
+   * @param isWalkable 回调函数，判断指定网格是否可通行
+   */
+  static std::vector<BattleVec2> findPath(
+      const BattleVec2& startPos, const BattleVec2& endPos,
+      const BattleProjection& projection,
+      const std::function<bool(int, int)>& isWalkable, int precision = 2);
+
+  /**
+   * 收集寻路的有效终点
+   * 终点子网格可通行时只有它本身；否则（例如终点是建筑）为周围一圈圈
+   * 向外扩展找到的所有可通行子网格
+   * @param eRow 终点子网格行（精度倍增坐标）
+   * @param eCol 终点子网格列
+   * @param cells 输出子网格下标 row * size + col，size 为子网格边长
+   * @return 是否找到有效终点
+   */
+  static bool findGoalCells(int eRow, int eCol, const BattleGrid& grid,
+                            int precision, std::vector<int>& cells);
+  static bool findGoalCells(int eRow, int eCol, const BattleGridView& grid,
+                            int precision, std::vector<int>& cells);
+};
+
+#endif  // __BATTLE_PATH_FINDER_H__
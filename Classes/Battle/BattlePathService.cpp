@@ -0,0 +1,166 @@
+#include "Battle/BattlePathService.h"
+
+#include <algorithm>
+
+BattlePathService::BattlePathService(int threadCount, int precision)
+    : _threadCount(std::max(threadCount, 0)),
+      _precision(precision),
+      _nextJob(0) {
+  _threads.reserve(_threadCount);
+  for (int i = 0; i < _threadCount; ++i) {
+    _threads.emplace_back(&BattlePathService::workerLoop, this);
+  }
+}
+
+BattlePathService::~BattlePathService() {
+  clear();
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stopping = true;
+  }
+  _workReady.notify_all();
+  for (std::thread& thread : _threads) {
+    thread.join();
+  }
+}
+
+void BattlePathService::submit(const BattlePathRequest& request) {
+  for (BattlePathRequest& pending : _pending) {
+    if (pending.soldier == request.soldier) {
+      pending = request;
+      return;
+    }
+  }
+  _pending.push_back(request);
+}
+
+void BattlePathService::dispatch(const BattleGrid& grid,
+                                 const BattleGrid& walls,
+                                 const BattleProjection& projection) {
+  if (_inFlight || _pending.empty()) {
+    return;
+  }
+
+  // 距离目标越近越先处理，距离相同时按士兵槽位，保证顺序确定
+  std::stable_sort(_pending.begin(), _pending.end(),
+                   [](const BattlePathRequest& a, const BattlePathRequest& b) {
+                     if (a.priority != b.priority) {
+                       return a.priority < b.priority;
+                     }
+                     return a.soldier.index() < b.soldier.index();
+                   });
+  size_t count = _pending.size();
+  if (_budget > 0) {
+    count = std::min(count, static_cast<size_t>(_budget));
+  }
+
+  _grid = grid;
+  _walls = walls;
+  _projection = projection;
+  _jobs.clear();
+  _results.resize(count);
+  for (size_t i = 0; i < count; ++i) {
+    const BattlePathRequest& request = _pending[i];
+    _results[i].request = request;
+    _results[i].path.clear();
+
+    auto job = std::find_if(_jobs.begin(), _jobs.end(), [&](const Job& j) {
+      return j.request.target == request.target &&
+             j.request.passWalls == request.passWalls &&
+             j.request.attackRange == request.attackRange;
+    });
+    if (job == _jobs.end()) {
+      Job created;
+      created.request = request;
+      _jobs.push_back(created);
+      job = _jobs.end() - 1;
+    }
+    job->results.push_back(static_cast<int>(i));
+  }
+  _pending.erase(_pending.begin(), _pending.begin() + count);
+  if (_fields.size() < _jobs.size()) {
+    _goalSets.resize(_jobs.size());
+    _fields.resize(_jobs.size());
+  }
+
+  _nextJob = 0;
+  _inFlight = true;
+  if (_threadCount == 0) {
+    runJobs();
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _activeWorkers = _threadCount;
+    _batch++;
+  }
+  _workReady.notify_all();
+}
+
+void BattlePathService::collect(std::vector<BattlePathResult>& results) {
+  results.clear();
+  if (!_inFlight) {
+    return;
+  }
+  if (_threadCount > 0) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _workDone.wait(lock, [this] { return _activeWorkers == 0; });
+  }
+  results.swap(_results);
+  _inFlight = false;
+}
+
+void BattlePathService::clear() {
+  std::vector<BattlePathResult> discarded;
+  collect(discarded);
+  _pending.clear();
+}
+
+void BattlePathService::runJob(int index) {
+  const BattlePathRequest& target = _jobs[index].request;
+  BattleGoalSet& goals = _goalSets[index];
+  BattleFlowField& field = _fields[index];
+  BattleGridView grid(_grid, target.passWalls ? &_walls : nullptr);
+  if (!goals.build(target.targetRow, target.targetCol, target.targetSize,
+                   BattleReal(target.attackRange), _projection, grid,
+                   _precision) ||
+      !field.build(goals, grid)) {
+    return;
+  }
+  for (int result : _jobs[index].results) {
+    BattlePathResult& entry = _results[result];
+    entry.path = field.tracePath(entry.request.start, _projection);
+  }
+}
+
+void BattlePathService::runJobs() {
+  const int count = static_cast<int>(_jobs.size());
+  while (true) {
+    int index = _nextJob.fetch_add(1);
+    if (index >= count) {
+      return;
+    }
+    runJob(index);
+  }
+}
+
+void BattlePathService::workerLoop() {
+  unsigned handled = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _workReady.wait(lock, [&] { return _stopping || _batch != handled; });
+      if (_stopping) {
+        return;
+      }
+      handled = _batch;
+    }
+
+    runJobs();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (--_activeWorkers == 0) {
+      _workDone.notify_all();
+    }
+  }
+}
@@ -0,0 +1,139 @@
+#ifndef __BATTLE_PATH_SERVICE_H__
+#define __BATTLE_PATH_SERVICE_H__
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Battle/BattleFlowField.h"
+#include "Battle/BattleGoalSet.h"
+#include "Battle/BattleGrid.h"
+#include "Battle/BattleHandle.h"
+
+/**
+ * 一个地面士兵的寻路请求
+ */
+struct BattlePathRequest {
+  BattleHandle soldier;  // 取回结果时用于确认士兵没有被替换
+  int target = -1;       // 目标建筑 id
+  bool passWalls = false;
+  int attackRange = 0;  // 取整后的攻击范围（像素）
+  BattleVec2 start;
+  BattleReal targetRow = 0;  // 目标建筑的中心网格坐标和尺寸，用于计算攻击位
+  BattleReal targetCol = 0;
+  int targetSize = 1;
+  BattleReal priority = 0;  // 越小越先处理（士兵到目标的距离）
+};
+
+/**
+ * 寻路结果，path 为空表示无法到达
+ */
+struct BattlePathResult {
+  BattlePathRequest request;
+  std::vector<BattleVec2> path;
+};
+
+/**
+ * 异步寻路服务
+ * 士兵提交请求后按当前方向继续移动。每个逻辑帧结束时 dispatch 按优先级
+ * 取出至多 budget 个请求，连同网格快照交给工作线程：同一目标、同一攻击
+ * 范围的请求为一组，每组在快照上计算攻击位并构建一次流场；下一帧开始时
+ * collect 等待这批计算完成并取回结果。
+ * 工作线程在构造时启动并常驻，每批只唤醒一次，逐个领取组的下标。
+ * 每帧处理哪些请求只取决于请求本身，与线程数和执行快慢无关，
+ * 同一份记录的模拟结果保持确定
+ */
+class BattlePathService {
+ public:
+  static const int DEFAULT_BUDGET = 16;  // 战斗中每帧派发的请求数
+
+  /**
+   * 构造函数
+   * @param threadCount 工作线程数，<= 0 时在 dispatch 中直接计算
+   * @param precision 流场精度倍数
+   */
+  BattlePathService(int threadCount, int precision);
+  ~BattlePathService();
+
+  BattlePathService(const BattlePathService&) = delete;
+  BattlePathService& operator=(const BattlePathService&) = delete;
+
+  /**
+   * 每帧最多派发的请求数，<= 0 表示不限
+   */
+  void setBudget(int requestsPerTick) { _budget = requestsPerTick; }
+  int getBudget() const { return _budget; }
+
+  /**
+   * 提交请求，同一士兵尚未派发的旧请求被替换
+   */
+  void submit(const BattlePathRequest& request);
+
+  /**
+   * 派发一批请求（上一批必须已经 collect）
+   * @param grid 可通行网格，复制为快照后调用方可以继续修改
+   * @param walls 存活的墙壁，passWalls 请求把它们视为可通行
+   */
+  void dispatch(const BattleGrid& grid, const BattleGrid& walls,
+                const BattleProjection& projection);
+
+  /**
+   * 等待已派发的请求全部完成，按派发顺序取回结果
+   */
+  void collect(std::vector<BattlePathResult>& results);
+
+  /**
+   * 已派发请求所用网格快照的版本（BattleGrid::getVersion）
+   */
+  unsigned getSnapshotVersion() const { return _grid.getVersion(); }
+
+  /**
+   * 尚未派发的请求数
+   */
+  size_t getPendingCount() const { return _pending.size(); }
+
+  /**
+   * 丢弃全部请求和结果
+   */
+  void clear();
+
+ private:
+  // 同一目标（及是否穿墙、攻击范围）的一组请求
+  struct Job {
+    BattlePathRequest request;  // 组内第一个请求，提供目标信息
+    std::vector<int> results;   // 在 _results 中的下标
+  };
+
+  void runJob(int job);
+  void runJobs();
+  void workerLoop();
+
+  int _threadCount;
+  int _precision;
+  int _budget = 0;
+  std::vector<BattlePathRequest> _pending;
+
+  // 当前批次，派发后到 collect 之前只由工作线程读写
+  BattleGrid _grid;
+  BattleGrid _walls;
+  BattleProjection _projection;
+  std::vector<Job> _jobs;
+  std::vector<BattleGoalSet> _goalSets;  // 每组一个，跨批次复用
+  std::vector<BattleFlowField> _fields;
+  std::vector<BattlePathResult> _results;
+  std::atomic<int> _nextJob;
+  bool _inFlight = false;
+
+  // 常驻工作线程，以下状态由 _mutex 保护
+  std::vector<std::thread> _threads;
+  std::mutex _mutex;
+  std::condition_variable _workReady;
+  std::condition_variable _workDone;
+  unsigned _batch = 0;     // 派发的批次编号，工作线程据此发现新任务
+  int _activeWorkers = 0;  // 仍在处理当前批次的工作线程数
+  bool _stopping = false;
+};
+
+#endif  // __BATTLE_PATH_SERVICE_H__
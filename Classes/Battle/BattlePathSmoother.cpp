@@ -0,0 +1,119 @@
+#include "Battle/BattlePathSmoother.h"
+
+#include <cstdint>
+#include <cstdlib>
+
+namespace {
+// 网格坐标放大的倍数，线段端点取整后按整数遍历
+const int kScale = 256;
+
+int64_t floorDiv(int64_t value, int64_t divisor) {
+  int64_t quotient = value / divisor;
+  return (value % divisor != 0 && value < 0) ? quotient - 1 : quotient;
+}
+
+void toScaled(const BattleVec2& point, const BattleProjection& projection,
+              int64_t& row, int64_t& col) {
+  BattleReal r, c;
+  projection.screenToGrid(point, r, c);
+  row = BattleMath::round(r * BattleReal(kScale));
+  col = BattleMath::round(c * BattleReal(kScale));
+}
+
+/**
+ * 按顺序访问线段 (r0, c0) - (r1, c1)（放大后的坐标）经过的网格
+ * 每一步比较到下一条行边界和列边界的距离（交叉相乘，没有除法）；
+ * 同时到达时经过的是网格顶点，两侧的网格都访问
+ * @param visit 返回 false 时停止
+ * @return 是否访问完整条线段
+ */
+template <typename Visit>
+bool walkSegment(int64_t r0, int64_t c0, int64_t r1, int64_t c1,
+                 const Visit& visit) {
+  int64_t row = floorDiv(r0, kScale);
+  int64_t col = floorDiv(c0, kScale);
+  const int64_t endRow = floorDiv(r1, kScale);
+  const int64_t endCol = floorDiv(c1, kScale);
+  const int64_t dr = r1 - r0;
+  const int64_t dc = c1 - c0;
+  const int stepRow = (dr > 0) - (dr < 0);
+  const int stepCol = (dc > 0) - (dc < 0);
+
+  if (!visit(row, col)) {
+    return false;
+  }
+  while (row != endRow || col != endCol) {
+    // 沿线段到下一条边界的距离，乘以另一个方向的长度后可以直接比较
+    int64_t toRow = stepRow > 0 ? (row + 1) * kScale - r0 : r0 - row * kScale;
+    int64_t toCol = stepCol > 0 ? (col + 1) * kScale - c0 : c0 - col * kScale;
+    int64_t rowTime = toRow * std::llabs(dc);
+    int64_t colTime = toCol * std::llabs(dr);
+    bool advanceRow = stepRow != 0 && (stepCol == 0 || rowTime <= colTime);
+    bool advanceCol = stepCol != 0 && (stepRow == 0 || colTime <= rowTime);
+    if (advanceRow && advanceCol) {
+      if (!visit(row + stepRow, col) || !visit(row, col + stepCol)) {
+        return false;
+      }
+    }
+    if (advanceRow) {
+      row += stepRow;
+    }
+    if (advanceCol) {
+      col += stepCol;
+    }
+    if (!visit(row, col)) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+void BattlePathSmoother::smooth(const BattleVec2& start,
+                                std::vector<BattleVec2>& path,
+                                const BattleProjection& projection,
+                                const BattleGridView& grid) {
+  if (path.size() < 2) {
+    return;
+  }
+
+  // path[i] 可以省略：从上一个保留点能直线到达 path[i + 1]
+  BattleVec2 anchor = start;
+  size_t count = 0;
+  for (size_t i = 0; i + 1 < path.size(); ++i) {
+    if (!hasLineOfSight(anchor, path[i + 1], projection, grid)) {
+      anchor = path[i];
+      path[count++] = path[i];
+    }
+  }
+  path[count++] = path.back();
+  path.resize(count);
+}
+
+bool BattlePathSmoother::hasLineOfSight(const BattleVec2& from,
+                                        const BattleVec2& to,
+                                        const BattleProjection& projection,
+                                        const BattleGridView& grid) {
+  int64_t r0, c0, r1, c1;
+  toScaled(from, projection, r0, c0);
+  toScaled(to, projection, r1, c1);
+  return walkSegment(r0, c0, r1, c1, [&](int64_t row, int64_t col) {
+    return grid.isWalkable(static_cast<int>(row), static_cast<int>(col));
+  });
+}
+
+void BattlePathSmoother::traceCells(const BattleVec2& from,
+                                    const BattleVec2& to,
+                                    const BattleProjection& projection,
+                                    std::vector<int>& cells) {
+  int64_t r0, c0, r1, c1;
+  toScaled(from, projection, r0, c0);
+  toScaled(to, projection, r1, c1);
+  const int64_t size = projection.gridSize;
+  walkSegment(r0, c0, r1, c1, [&](int64_t row, int64_t col) {
+    if (row >= 0 && row < size && col >= 0 && col < size) {
+      cells.push_back(static_cast<int>(row * size + col));
+    }
+    return true;
+  });
+}
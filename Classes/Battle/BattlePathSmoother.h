@@ -0,0 +1,43 @@
+#ifndef __BATTLE_PATH_SMOOTHER_H__
+#define __BATTLE_PATH_SMOOTHER_H__
+
+#include <vector>
+
+#include "Battle/BattleGrid.h"
+
+/**
+ * 路径平滑（拉绳）
+ * 寻路和流场给出的路径每个子网格一个点，士兵每走一小段就转一次向。
+ * 平滑时沿路径贪心地跳过从上一个保留点可以直线到达的点，只保留拐角处
+ * 的路径点。直线是否可行由线段经过的所有网格判断（supercover：
+ * 恰好经过网格顶点时两侧的网格都算），坐标按整数精确计算
+ */
+class BattlePathSmoother {
+ public:
+  /**
+   * 平滑路径，终点总是保留
+   * @param start 起点（士兵当前位置，不在 path 中）
+   * @param path 路径点列表（地图层坐标），原地修改
+   * @param grid 寻路使用的网格
+   */
+  static void smooth(const BattleVec2& start, std::vector<BattleVec2>& path,
+                     const BattleProjection& projection,
+                     const BattleGridView& grid);
+
+  /**
+   * 两点之间的线段经过的网格是否全部可通行
+   */
+  static bool hasLineOfSight(const BattleVec2& from, const BattleVec2& to,
+                             const BattleProjection& projection,
+                             const BattleGridView& grid);
+
+  /**
+   * 线段经过的网格，按经过的顺序追加到 cells（row * gridSize + col），
+   * 地图外的网格跳过
+   */
+  static void traceCells(const BattleVec2& from, const BattleVec2& to,
+                         const BattleProjection& projection,
+                         std::vector<int>& cells);
+};
+
+#endif  // __BATTLE_PATH_SMOOTHER_H__
@@ -0,0 +1,125 @@
+#include "Battle/BattleSoldierArray.h"
+
+#include <algorithm>
+
+#include "Battle/BattleEntities.h"
+
+int BattleSoldierArray::add(SoldierType soldierType, int soldierLevel,
+                            const BattleSoldierStats& stats,
+                            const BattleVec2& position) {
+  int id = size();
+  resize(id + 1);
+  reset(id, soldierType, soldierLevel, stats, position);
+  return id;
+}
+
+void BattleSoldierArray::reset(int i, SoldierType soldierType,
+                               int soldierLevel,
+                               const BattleSoldierStats& stats,
+                               const BattleVec2& position) {
+  type[i] = soldierType;
+  level[i] = soldierLevel;
+  category[i] = stats.category;
+  attackType[i] = stats.attackType;
+  maxHP[i] = stats.maxHP;
+  hp[i] = stats.maxHP;
+  attackDamage[i] = stats.attackDamage;
+  attackSpeed[i] = stats.attackSpeed;
+  moveSpeed[i] = stats.moveSpeed;
+  attackRange[i] = stats.attackRange;
+
+  state[i] = SoldierState::IDLE;
+  x[i] = position.x;
+  y[i] = position.y;
+  target[i] = -1;
+  cooldown[i] = 0.0f;
+
+  moveTargetX[i] = 0.0f;
+  moveTargetY[i] = 0.0f;
+  hasMoveTarget[i] = 0;
+  moveMask[i] = 0.0f;
+  path[i].clear();
+  pathIndex[i] = 0;
+}
+
+void BattleSoldierArray::clear() {
+  type.clear();
+  level.clear();
+  category.clear();
+  attackType.clear();
+  maxHP.clear();
+  hp.clear();
+  attackDamage.clear();
+  attackSpeed.clear();
+  moveSpeed.clear();
+  attackRange.clear();
+
+  state.clear();
+  x.clear();
+  y.clear();
+  target.clear();
+  cooldown.clear();
+
+  moveTargetX.clear();
+  moveTargetY.clear();
+  hasMoveTarget.clear();
+  moveMask.clear();
+  path.clear();
+  pathIndex.clear();
+}
+
+void BattleSoldierArray::resize(int n) {
+  type.resize(n);
+  level.resize(n);
+  category.resize(n);
+  attackType.resize(n);
+  maxHP.resize(n);
+  hp.resize(n);
+  attackDamage.resize(n);
+  attackSpeed.resize(n);
+  moveSpeed.resize(n);
+  attackRange.resize(n);
+
+  state.resize(n);
+  x.resize(n);
+  y.resize(n);
+  target.resize(n);
+  cooldown.resize(n);
+
+  moveTargetX.resize(n);
+  moveTargetY.resize(n);
+  hasMoveTarget.resize(n);
+  moveMask.resize(n);
+  path.resize(n);
+  pathIndex.resize(n);
+}
+
+void BattleSoldierArray::tickCooldowns(BattleReal dt) {
+  const int n = size();
+  BattleReal* cd = cooldown.data();
+  for (int i = 0; i < n; ++i) {
+    cd[i] = (cd[i] > 0.0f) ? cd[i] - dt : cd[i];
+  }
+}
+
+void BattleSoldierArray::integrateMovement(BattleReal dt) {
+  const int n = size();
+  BattleReal* px = x.data();
+  BattleReal* py = y.data();
+  const BattleReal* tx = moveTargetX.data();
+  const BattleReal* ty = moveTargetY.data();
+  const BattleReal* speed = moveSpeed.data();
+  const BattleReal* mask = moveMask.data();
+
+  // 无分支循环，便于编译器向量化
+  for (int i = 0; i < n; ++i) {
+    BattleReal dx = tx[i] - px[i];
+    BattleReal dy = ty[i] - py[i];
+    BattleReal distance = BattleMath::length(dx, dy);
+    BattleReal step = std::min(speed[i] * dt, distance);
+    BattleReal scale = (distance > 0.0f) ? step / distance : 0.0f;
+    scale *= mask[i];
+    px[i] += dx * scale;
+    py[i] += dy * scale;
+  }
+}
@@ -0,0 +1,97 @@
+#ifndef __BATTLE_SOLDIER_ARRAY_H__
+#define __BATTLE_SOLDIER_ARRAY_H__
+
+#include <cstdint>
+#include <vector>
+
+#include "Battle/BattleMath.h"
+#include "Battle/BattleTypes.h"
+
+struct BattleSoldierStats;
+
+/**
+ * 战斗中的士兵（结构数组布局）
+ * 每个属性单独存放在连续数组中，下标即士兵 id（槽位）。
+ * 移动和冷却等逐帧计算以批量循环的方式处理全部士兵，
+ * 状态机等分支较多的逻辑仍由 BattleWorld 逐个士兵处理
+ */
+struct BattleSoldierArray {
+  // 属性
+  std::vector<SoldierType> type;
+  std::vector<int> level;
+  std::vector<SoldierCategory> category;
+  std::vector<AttackType> attackType;
+  std::vector<BattleReal> maxHP;
+  std::vector<BattleReal> hp;
+  std::vector<BattleReal> attackDamage;
+  std::vector<BattleReal> attackSpeed;  // 每秒攻击次数
+  std::vector<BattleReal> moveSpeed;    // 像素/秒
+  std::vector<BattleReal> attackRange;  // 像素
+
+  // 状态
+  std::vector<SoldierState> state;
+  std::vector<BattleReal> x;  // 位置（地图层坐标）
+  std::vector<BattleReal> y;
+  std::vector<int> target;  // 目标建筑 id，-1 表示无目标
+  std::vector<BattleReal> cooldown;
+
+  // 移动
+  std::vector<BattleReal> moveTargetX;  // 当前移动的目标点
+  std::vector<BattleReal> moveTargetY;
+  std::vector<uint8_t> hasMoveTarget;  // 是否有移动目标
+  std::vector<BattleReal> moveMask;    // 本帧是否参与批量移动（1 或 0）
+  std::vector<std::vector<BattleVec2>> path;
+  std::vector<int> pathIndex;
+
+  /**
+   * 添加士兵
+   * @return 士兵 id
+   */
+  int add(SoldierType soldierType, int soldierLevel,
+          const BattleSoldierStats& stats, const BattleVec2& position);
+
+  /**
+   * 用新士兵覆盖已有的槽位（复用死亡士兵的槽位）
+   */
+  void reset(int i, SoldierType soldierType, int soldierLevel,
+             const BattleSoldierStats& stats, const BattleVec2& position);
+
+  /**
+   * 移除所有士兵
+   */
+  void clear();
+
+  int size() const { return static_cast<int>(state.size()); }
+  bool empty() const { return state.empty(); }
+
+  bool isAlive(int i) const {
+    return state[i] != SoldierState::DEAD && hp[i] > 0;
+  }
+
+  BattleVec2 position(int i) const { return BattleVec2(x[i], y[i]); }
+
+  void setPosition(int i, const BattleVec2& pos) {
+    x[i] = pos.x;
+    y[i] = pos.y;
+  }
+
+  BattleVec2 moveTarget(int i) const {
+    return BattleVec2(moveTargetX[i], moveTargetY[i]);
+  }
+
+  /**
+   * 批量更新攻击冷却（冷却大于 0 时减去 dt）
+   */
+  void tickCooldowns(BattleReal dt);
+
+  /**
+   * 批量移动：moveMask 为 1 的士兵向移动目标前进 moveSpeed * dt，
+   * 不会越过目标点
+   */
+  void integrateMovement(BattleReal dt);
+
+ private:
+  void resize(int n);
+};
+
+#endif  // __BATTLE_SOLDIER_ARRAY_H__
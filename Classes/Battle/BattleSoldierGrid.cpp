@@ -0,0 +1,57 @@
+#include "Battle/BattleSoldierGrid.h"
+
+void BattleSoldierGrid::reset(const BattleProjection& projection,
+                              BattleReal cellSize) {
+  // 地图是菱形，取四个角的外接矩形
+  const BattleReal size = BattleReal(projection.gridSize);
+  const BattleVec2 corners[4] = {projection.gridToScene(0, 0),
+                                 projection.gridToScene(size, 0),
+                                 projection.gridToScene(0, size),
+                                 projection.gridToScene(size, size)};
+  BattleReal maxX = corners[0].x;
+  BattleReal maxY = corners[0].y;
+  _minX = corners[0].x;
+  _minY = corners[0].y;
+  for (const BattleVec2& corner : corners) {
+    _minX = std::min(_minX, corner.x);
+    _minY = std::min(_minY, corner.y);
+    maxX = std::max(maxX, corner.x);
+    maxY = std::max(maxY, corner.y);
+  }
+
+  _cellSize = cellSize > 0 ? cellSize : BattleReal(1);
+  _columns = std::max(static_cast<int>((maxX - _minX) / _cellSize) + 1, 1);
+  _rows = std::max(static_cast<int>((maxY - _minY) / _cellSize) + 1, 1);
+  _cellStart.assign(_columns * _rows + 1, 0);
+  _items.clear();
+}
+
+void BattleSoldierGrid::build(const BattleSoldierArray& soldiers) {
+  const int count = soldiers.size();
+  _itemCell.assign(count, -1);
+  std::fill(_cellStart.begin(), _cellStart.end(), 0);
+
+  // 1. 统计每个格子的士兵数
+  int living = 0;
+  for (int i = 0; i < count; ++i) {
+    if (soldiers.isAlive(i)) {
+      int cell = cellY(soldiers.y[i]) * _columns + cellX(soldiers.x[i]);
+      _itemCell[i] = cell;
+      _cellStart[cell]++;
+      living++;
+    }
+  }
+
+  // 2. 前缀和得到每个格子的终点，再按 id 从大到小向前放入：
+  //    放完后 _cellStart 恰好是各格子的起点，格子内保持升序
+  for (size_t cell = 1; cell < _cellStart.size(); ++cell) {
+    _cellStart[cell] += _cellStart[cell - 1];
+  }
+  _items.resize(living);
+  for (int i = count - 1; i >= 0; --i) {
+    int cell = _itemCell[i];
+    if (cell >= 0) {
+      _items[--_cellStart[cell]] = i;
+    }
+  }
+}
@@ -0,0 +1,78 @@
+#ifndef __BATTLE_SOLDIER_GRID_H__
+#define __BATTLE_SOLDIER_GRID_H__
+
+#include <algorithm>
+#include <vector>
+
+#include "Battle/BattleGrid.h"
+#include "Battle/BattleSoldierArray.h"
+
+/**
+ * 存活士兵的空间哈希
+ * 把地图层坐标划分为边长固定的正方形格子，每帧士兵移动后整体重建一次
+ * （按格子计数排序，存放在连续数组中）。防御建筑、陷阱和法术只检查
+ * 半径覆盖的格子，不必遍历全部士兵。
+ * 同一格子内的士兵按 id 升序排列
+ */
+class BattleSoldierGrid {
+ public:
+  /**
+   * 按地图范围划分格子，清空所有士兵
+   * @param cellSize 格子边长（像素），取常用查询半径附近的值
+   */
+  void reset(const BattleProjection& projection, BattleReal cellSize);
+
+  /**
+   * 用当前存活士兵的位置重建
+   */
+  void build(const BattleSoldierArray& soldiers);
+
+  /**
+   * 依次访问与圆 (center, radius) 的外接正方形相交的格子中的士兵 id
+   * 只按格子粗筛，调用方仍需判断距离；地图外的士兵归入最近的边缘格子
+   */
+  template <typename Visitor>
+  void forEachNear(const BattleVec2& center, BattleReal radius,
+                   Visitor visitor) const {
+    if (_items.empty()) {
+      return;
+    }
+    int col0 = cellX(center.x - radius);
+    int col1 = cellX(center.x + radius);
+    int row0 = cellY(center.y - radius);
+    int row1 = cellY(center.y + radius);
+    for (int row = row0; row <= row1; ++row) {
+      for (int col = col0; col <= col1; ++col) {
+        int cell = row * _columns + col;
+        for (int i = _cellStart[cell]; i < _cellStart[cell + 1]; ++i) {
+          visitor(_items[i]);
+        }
+      }
+    }
+  }
+
+  int getColumns() const { return _columns; }
+  int getRows() const { return _rows; }
+
+ private:
+  int cellX(BattleReal x) const {
+    return std::min(
+        std::max(static_cast<int>((x - _minX) / _cellSize), 0),
+        _columns - 1);
+  }
+  int cellY(BattleReal y) const {
+    return std::min(std::max(static_cast<int>((y - _minY) / _cellSize), 0),
+                    _rows - 1);
+  }
+
+  BattleReal _minX = 0;
+  BattleReal _minY = 0;
+  BattleReal _cellSize = 1;
+  int _columns = 1;
+  int _rows = 1;
+  std::vector<int> _cellStart;  // 每个格子在 _items 中的起点，末尾多一项
+  std::vector<int> _items;      // 按格子排列的士兵 id
+  std::vector<int> _itemCell;   // 重建用的临时数组：每个士兵所在的格子
+};
+
+#endif  // __BATTLE_SOLDIER_GRID_H__
@@ -0,0 +1,124 @@
+#include "Battle/BattleTypes.h"
+
+bool BattleTypeUtils::parseSoldierType(const std::string& key,
+                                       SoldierType& type) {
+  if (key == "barbarian") {
+    type = SoldierType::BARBARIAN;
+  } else if (key == "archer") {
+    type = SoldierType::ARCHER;
+  } else if (key == "giant") {
+    type = SoldierType::GIANT;
+  } else if (key == "bomber") {
+    type = SoldierType::BOMBER;
+  } else if (key == "dragon") {
+    type = SoldierType::DRAGON;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+const char* BattleTypeUtils::soldierTypeKey(SoldierType type) {
+  switch (type) {
+    case SoldierType::BARBARIAN:
+      return "barbarian";
+    case SoldierType::ARCHER:
+      return "archer";
+    case SoldierType::GIANT:
+      return "giant";
+    case SoldierType::BOMBER:
+      return "bomber";
+    case SoldierType::DRAGON:
+      return "dragon";
+  }
+  return "barbarian";
+}
+
+bool BattleTypeUtils::parseSpellType(const std::string& key, SpellType& type) {
+  if (key == "Heal") {
+    type = SpellType::HEAL;
+  } else if (key == "Lightning") {
+    type = SpellType::LIGHTNING;
+  } else if (key == "Rage") {
+    type = SpellType::RAGE;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+const char* BattleTypeUtils::spellTypeKey(SpellType type) {
+  switch (type) {
+    case SpellType::HEAL:
+      return "Heal";
+    case SpellType::LIGHTNING:
+      return "Lightning";
+    case SpellType::RAGE:
+      return "Rage";
+  }
+  return "Heal";
+}
+
+bool BattleTypeUtils::parseBuildingType(const std::string& key,
+                                        BuildingType& type) {
+  if (key == "TOWN_HALL") {
+    type = BuildingType::TOWN_HALL;
+  } else if (key == "DEFENSE") {
+    type = BuildingType::DEFENSE;
+  } else if (key == "RESOURCE") {
+    type = BuildingType::RESOURCE;
+  } else if (key == "STORAGE") {
+    type = BuildingType::STORAGE;
+  } else if (key == "BARRACKS") {
+    type = BuildingType::BARRACKS;
+  } else if (key == "WALL") {
+    type = BuildingType::WALL;
+  } else if (key == "TRAP") {
+    type = BuildingType::TRAP;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool BattleTypeUtils::parseAttackType(const std::string& key,
+                                      AttackType& type) {
+  if (key == "Any") {
+    type = AttackType::ANY;
+  } else if (key == "Defense") {
+    type = AttackType::DEFENSE;
+  } else if (key == "Resource") {
+    type = AttackType::RESOURCE;
+  } else if (key == "TownHall") {
+    type = AttackType::TOWN_HALL;
+  } else if (key == "WALL") {
+    type = AttackType::WALL;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool BattleTypeUtils::parseSoldierCategory(const std::string& key,
+                                           SoldierCategory& category) {
+  if (key == "LAND") {
+    category = SoldierCategory::LAND;
+  } else if (key == "AIR") {
+    category = SoldierCategory::AIR;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool BattleTypeUtils::parseSpellCategory(const std::string& key,
+                                         SpellCategory& category) {
+  if (key == "INSTANT") {
+    category = SpellCategory::INSTANT;
+  } else if (key == "DURATION") {
+    category = SpellCategory::DURATION;
+  } else {
+    return false;
+  }
+  return true;
+}
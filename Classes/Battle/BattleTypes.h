@@ -0,0 +1,130 @@
+#ifndef __BATTLE_TYPES_H__
+#define __BATTLE_TYPES_H__
+
+#include <string>
+
+/**
+ * 战斗相关的基础枚举
+ * 不依赖 cocos2d，游戏层（精灵）与无头战斗核心共用同一套定义
+ */
+
+/**
+ * 士兵状态枚举
+ */
+enum class SoldierState {
+  IDLE,       // 待机
+  MOVING,     // 移动中
+  ATTACKING,  // 攻击中
+  DEAD        // 死亡
+};
+
+/**
+ * 士兵分类枚举
+ */
+enum class SoldierCategory {
+  LAND,  // 陆军
+  AIR,   // 空军
+};
+
+/**
+ * 士兵类型枚举
+ */
+enum class SoldierType {
+  BARBARIAN,  // 野蛮人
+  ARCHER,     // 弓箭手
+  GIANT,      // 巨人
+  BOMBER,     // 炸弹人
+  DRAGON      // 飞龙
+};
+
+/**
+ * 攻击类型枚举
+ */
+enum class AttackType {
+  ANY,        // 任意目标
+  DEFENSE,    // 优先防御建筑
+  RESOURCE,   // 优先资源建筑
+  TOWN_HALL,  // 优先大本营
+  WALL        // 优先墙
+};
+
+/**
+ * 建筑类型枚举
+ */
+enum class BuildingType {
+  TOWN_HALL,  // 大本营
+  DEFENSE,    // 防御建筑
+  RESOURCE,   // 资源建筑
+  STORAGE,    // 储存建筑
+  BARRACKS,   // 兵营
+  WALL,       // 城墙
+  TRAP        // 陷阱
+};
+
+/**
+ * 法术类型枚举
+ */
+enum class SpellType {
+  HEAL,       // 治疗法术
+  LIGHTNING,  // 雷电法术
+  RAGE        // 狂暴法术
+};
+
+/**
+ * 法术效果类型枚举
+ */
+enum class SpellCategory {
+  INSTANT,  // 瞬时效果（立即生效）
+  DURATION  // 持续效果（持续一段时间）
+};
+
+/**
+ * 枚举与配置/记录文件中字符串键之间的转换
+ */
+class BattleTypeUtils {
+ public:
+  /**
+   * 解析士兵类型键（"barbarian", "archer", "giant", "bomber", "dragon"）
+   * @return 是否为已知类型
+   */
+  static bool parseSoldierType(const std::string& key, SoldierType& type);
+
+  /**
+   * 获取士兵类型对应的配置键
+   */
+  static const char* soldierTypeKey(SoldierType type);
+
+  /**
+   * 解析法术类型键（"Heal", "Lightning", "Rage"）
+   */
+  static bool parseSpellType(const std::string& key, SpellType& type);
+
+  /**
+   * 获取法术类型对应的配置键
+   */
+  static const char* spellTypeKey(SpellType type);
+
+  /**
+   * 解析建筑类型键（building.json 中的 type 字段，如 "TOWN_HALL"）
+   */
+  static bool parseBuildingType(const std::string& key, BuildingType& type);
+
+  /**
+   * 解析攻击偏好（soilder.json 中的 AttackType 字段，如 "Any"）
+   */
+  static bool parseAttackType(const std::string& key, AttackType& type);
+
+  /**
+   * 解析士兵分类（soilder.json 中的 SoldierType 字段，"LAND" 或 "AIR"）
+   */
+  static bool parseSoldierCategory(const std::string& key,
+                                   SoldierCategory& category);
+
+  /**
+   * 解析法术效果类型（spell.json 中的 Category 字段）
+   */
+  static bool parseSpellCategory(const std::string& key,
+                                 SpellCategory& category);
+};
+
+#endif  // __BATTLE_TYPES_H__
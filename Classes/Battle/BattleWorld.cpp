@@ -0,0 +1,1058 @@
+#include "Battle/BattleWorld.h"
+
+#include <algorithm>
+
+#include "Battle/BattlePathFinder.h"
+#include "Battle/BattlePathSmoother.h"
+
+namespace {
+// 炸弹人爆炸半径（像素）
+const BattleReal kBomberExplosionRadius = 100.0f;
+// 士兵到达路径点的判定距离（像素）
+const BattleReal kWaypointReachDistance = 5.0f;
+// 流场的精度倍数（每个网格划分为 4x4 个子网格）
+const int kFlowFieldPrecision = 4;
+// 破墙寻路的精度倍数（每个网格划分为 2x2 个子网格）
+const int kBreachPrecision = 2;
+// 一段墙折算代价时最多计入的拆除时间（秒）
+const BattleReal kMaxBreachSeconds = 60.0f;
+// 保留的网格变化记录数，流场落后更多版本时重新构建
+const size_t kMaxGridChanges = 32;
+
+// 攻击位按攻击范围向下取整到像素计算，范围相近的士兵共用流场，
+// 到达攻击位时一定在实际的攻击范围以内
+int attackRangeKey(BattleReal attackRange) {
+  return std::max(BattleMath::round(attackRange - BattleReal(0.5f)), 0);
+}
+}  // namespace
+
+BattleWorld::BattleWorld(const BattleProjection& projection)
+    : _projection(projection),
+      _grid(projection.gridSize),
+      _wallGrid(projection.gridSize),
+      _soldierCellSize(projection.gridPixelLength()) {
+  // 还没有防御建筑时先按一个网格划分，addBuilding 再按最大攻击范围调整
+  _soldierGrid.reset(projection, _soldierCellSize);
+}
+
+int BattleWorld::addBuilding(const std::string& name, int level,
+                             const BattleBuildingStats& stats, BattleReal row,
+                             BattleReal col, BattleReal hp) {
+  BattleBuilding building;
+  building.id = static_cast<int>(_buildings.size());
+  building.name = name;
+  building.type = stats.type;
+  building.level = level;
+  building.row = row;
+  building.col = col;
+  building.gridCount = stats.gridCount;
+  building.position = _projection.buildingAnchor(row, col, stats.gridCount);
+  building.maxHP = stats.maxHP;
+  building.hp = (hp >= 0.0f) ? hp : stats.maxHP;
+  building.damage = stats.damage;
+  building.attackSpeed = stats.attackSpeed;
+
+  const BattleReal range = _projection.rangeToPixels(stats.attackRange);
+  if (stats.type == BuildingType::DEFENSE) {
+    building.defenseRange = range;
+    // 防御建筑每帧都查询附近士兵，格子边长取最大的攻击范围
+    if (range > _soldierCellSize) {
+      _soldierCellSize = range;
+      _soldierGrid.reset(_projection, _soldierCellSize);
+      _soldierGrid.build(_soldiers);
+    }
+  } else if (stats.type == BuildingType::TRAP) {
+    building.triggerRange = range;
+    building.armed = true;
+  }
+
+  // 存活的建筑阻挡通行
+  if (building.isAlive()) {
+    setGridArea(static_cast<int>(row), static_cast<int>(col), stats.gridCount,
+                true);
+    if (stats.type == BuildingType::WALL) {
+      _wallGrid.setArea(static_cast<int>(row), static_cast<int>(col), 1, true);
+    }
+  }
+
+  if (building.isTargetable()) {
+    _targetGroups[getTargetGroup(building.type)].push_back(building.id);
+  }
+  _buildings.push_back(building);
+  return building.id;
+}
+
+int BattleWorld::addSoldier(SoldierType type, int level,
+                            const BattleSoldierStats& stats,
+                            const BattleVec2& position) {
+  // 优先复用死亡士兵的槽位，数组长度不随部署次数增长
+  int soldier = _soldierHandles.allocate().index();
+  if (soldier < _soldiers.size()) {
+    _soldiers.reset(soldier, type, level, stats, position);
+    return soldier;
+  }
+  return _soldiers.add(type, level, stats, position);
+}
+
+int BattleWorld::castSpell(SpellType type, const BattleSpellStats& stats,
+                           const BattleVec2& position) {
+  BattleSpell spell;
+  spell.id = _spellHandles.allocate().index();
+  spell.type = type;
+  spell.stats = stats;
+  spell.position = position;
+  spell.active = true;
+
+  if (type == SpellType::HEAL && stats.duration > 0.0f) {
+    spell.healPerSecond = stats.amount / stats.duration;
+  }
+  // 狂暴倍率未配置时使用默认值 1.5
+  if (type == SpellType::RAGE && spell.stats.ratio <= 0.0f) {
+    spell.stats.ratio = 1.5f;
+  }
+
+  if (spell.id < static_cast<int>(_spells.size())) {
+    _spells[spell.id] = spell;
+  } else {
+    _spells.push_back(spell);
+  }
+  // 上一帧之后可能部署了新士兵
+  _soldierGrid.build(_soldiers);
+  applySpell(_spells[spell.id]);
+  return spell.id;
+}
+
+void BattleWorld::update(BattleReal dt) {
+  _damageReport.clear();
+  if (_pathService) {
+    applyPathResults();
+  }
+  updateSoldiers(dt);
+  // 本帧士兵不再移动，法术、防御建筑和陷阱按格子查找附近的士兵
+  _soldierGrid.build(_soldiers);
+
+  for (BattleSpell& spell : _spells) {
+    updateSpell(spell, dt);
+  }
+
+  // 没有士兵时防御建筑和陷阱无需检测
+  if (!_soldiers.empty()) {
+    for (BattleBuilding& building : _buildings) {
+      if (!building.isAlive()) {
+        continue;
+      }
+      if (building.type == BuildingType::DEFENSE) {
+        updateDefense(building, dt);
+      } else if (building.type == BuildingType::TRAP && building.armed) {
+        updateTrap(building);
+      }
+    }
+  }
+
+  resolveDamage();
+
+  // 本帧的寻路请求在下一帧开始前由工作线程计算
+  if (_pathService && _pathService->getPendingCount() > 0) {
+    _pathService->dispatch(_grid, _wallGrid, _projection);
+  }
+}
+
+void BattleWorld::clearUnits() {
+  if (_pathService) {
+    _pathService->clear();
+  }
+  _pathResults.clear();
+  for (BattleSpell& spell : _spells) {
+    if (spell.active) {
+      endSpell(spell);
+    }
+  }
+  _spells.clear();
+  _soldiers.clear();
+  _soldierGrid.build(_soldiers);
+  _spellHandles.clear();
+  _soldierHandles.clear();
+  _damage.clear();
+  _damageReport.clear();
+  for (BattleBuilding& building : _buildings) {
+    building.targetSoldier = BattleHandle();
+  }
+}
+
+bool BattleWorld::getResult(BattleResult& result) const {
+  int totalCount = 0;
+  int destroyedCount = 0;
+  bool townHallDestroyed = false;
+
+  for (const BattleBuilding& building : _buildings) {
+    if (building.type == BuildingType::WALL) {
+      continue;
+    }
+
+    totalCount++;
+    if (!building.isAlive()) {
+      destroyedCount++;
+      if (building.type == BuildingType::TOWN_HALL) {
+        townHallDestroyed = true;
+      }
+    }
+  }
+
+  return BattleResult::evaluate(totalCount, destroyedCount, townHallDestroyed,
+                                result);
+}
+
+bool BattleWorld::hasLivingSoldiers() const {
+  for (int i = 0; i < _soldiers.size(); ++i) {
+    if (_soldiers.isAlive(i)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void BattleWorld::updateSoldiers(BattleReal dt) {
+  const int count = _soldiers.size();
+
+  // 1. 批量更新攻击冷却
+  _soldiers.tickCooldowns(dt);
+
+  // 2. 逐个处理状态机，移动中的士兵在 prepareMove 中标记 moveMask
+  std::fill(_soldiers.moveMask.begin(), _soldiers.moveMask.end(),
+            BattleReal(0));
+  for (int i = 0; i < count; ++i) {
+    if (_soldiers.isAlive(i)) {
+      updateSoldierState(i, dt);
+    }
+  }
+
+  // 3. 批量移动
+  _soldiers.integrateMovement(dt);
+
+  // 4. 移动后检查是否进入攻击范围
+  for (int i = 0; i < count; ++i) {
+    if (_soldiers.moveMask[i] > 0.0f) {
+      afterMove(i);
+    }
+  }
+}
+
+void BattleWorld::updateSoldierState(int soldier, BattleReal dt) {
+  switch (_soldiers.state[soldier]) {
+    case SoldierState::IDLE:
+      // 待机状态：寻找目标，状态在 findTarget 中设置
+      findTarget(soldier);
+      break;
+
+    case SoldierState::MOVING:
+      prepareMove(soldier);
+      break;
+
+    case SoldierState::ATTACKING: {
+      int targetId = _soldiers.target[soldier];
+      if (isTargetValid(targetId)) {
+        const BattleBuilding& target = _buildings[targetId];
+        if (isInRange(soldier, target)) {
+          soldierAttack(soldier, dt);
+        } else {
+          // 目标超出范围，移动到目标位置
+          setMoveTarget(soldier, target.position);
+          _soldiers.state[soldier] = SoldierState::MOVING;
+        }
+      } else {
+        // 目标消失或被摧毁，回到待机状态
+        _soldiers.target[soldier] = -1;
+        clearMoveTarget(soldier);
+        _soldiers.state[soldier] = SoldierState::IDLE;
+      }
+      break;
+    }
+
+    case SoldierState::DEAD:
+      break;
+  }
+}
+
+void BattleWorld::prepareMove(int soldier) {
+  if (!_soldiers.hasMoveTarget[soldier]) {
+    // 正在等待异步寻路的结果；目标在此期间被摧毁时重新寻找目标
+    if (!isTargetValid(_soldiers.target[soldier])) {
+      _soldiers.target[soldier] = -1;
+      _soldiers.state[soldier] = SoldierState::IDLE;
+    }
+    return;
+  }
+
+  BattleVec2 position = _soldiers.position(soldier);
+  BattleReal distance = position.distance(_soldiers.moveTarget(soldier));
+
+  // 如果已经到达目标位置
+  if (distance < kWaypointReachDistance) {
+    // 检查是否有后续路径点
+    std::vector<BattleVec2>& path = _soldiers.path[soldier];
+    int& pathIndex = _soldiers.pathIndex[soldier];
+    if (!path.empty() && pathIndex < static_cast<int>(path.size()) - 1) {
+      // 切换到下一个路径点，在本帧继续移动，避免停顿
+      pathIndex++;
+      _soldiers.moveTargetX[soldier] = path[pathIndex].x;
+      _soldiers.moveTargetY[soldier] = path[pathIndex].y;
+    } else {
+      clearMoveTarget(soldier);
+      _soldiers.state[soldier] = SoldierState::IDLE;
+      return;
+    }
+  }
+
+  _soldiers.moveMask[soldier] = 1.0f;
+}
+
+void BattleWorld::afterMove(int soldier) {
+  // 炸弹人移动过程中如果遇到任何墙壁，都应该攻击
+  if (_soldiers.attackType[soldier] == AttackType::WALL) {
+    for (int wall : _targetGroups[GROUP_WALL]) {
+      if (isInRange(soldier, _buildings[wall])) {
+        _soldiers.target[soldier] = wall;
+        _soldiers.state[soldier] = SoldierState::ATTACKING;
+        clearMoveTarget(soldier);
+        return;
+      }
+    }
+  }
+
+  // 如果正在移动向目标，检查是否进入攻击范围
+  int targetId = _soldiers.target[soldier];
+  if (targetId >= 0) {
+    if (isTargetValid(targetId)) {
+      if (isInRange(soldier, _buildings[targetId])) {
+        _soldiers.state[soldier] = SoldierState::ATTACKING;
+        clearMoveTarget(soldier);
+      }
+    } else {
+      // 目标被摧毁，清除目标并回到待机状态
+      _soldiers.target[soldier] = -1;
+      clearMoveTarget(soldier);
+      _soldiers.state[soldier] = SoldierState::IDLE;
+    }
+  }
+}
+
+void BattleWorld::soldierAttack(int soldier, BattleReal dt) {
+  if (_soldiers.type[soldier] == SoldierType::BOMBER) {
+    bomberAttack(soldier, dt);
+    return;
+  }
+
+  if (_soldiers.cooldown[soldier] > 0) {
+    return;
+  }
+
+  // 目标被摧毁后在 resolveDamage 中回到待机状态
+  _damage.addBuildingDamage(_soldiers.target[soldier],
+                            _soldiers.attackDamage[soldier]);
+
+  // 重置攻击冷却
+  _soldiers.cooldown[soldier] = 1.0f / _soldiers.attackSpeed[soldier];
+}
+
+void BattleWorld::bomberAttack(int soldier, BattleReal dt) {
+  if (_soldiers.cooldown[soldier] > 0) {
+    _soldiers.cooldown[soldier] -= dt;
+    return;
+  }
+
+  // 对爆炸半径内的所有建筑造成伤害
+  BattleVec2 position = _soldiers.position(soldier);
+  for (BattleBuilding& building : _buildings) {
+    if (!building.isTargetable()) {
+      continue;
+    }
+    if (position.distance(building.position) <= kBomberExplosionRadius) {
+      _damage.addBuildingDamage(building.id, _soldiers.attackDamage[soldier]);
+    }
+  }
+
+  // 炸弹人攻击后立即死亡，本帧之后的防御建筑不会再瞄准它
+  killSoldier(soldier);
+}
+
+bool BattleWorld::findTarget(int soldier) {
+  BattleVec2 position = _soldiers.position(soldier);
+  AttackType attackType = _soldiers.attackType[soldier];
+  BattleReal bestDistance = BattleMath::maxValue();
+
+  // 1. 优先目标
+  int finalTarget = -1;
+  switch (attackType) {
+    case AttackType::ANY:
+      // 优先目标就是非墙备选
+      break;
+    case AttackType::DEFENSE:
+      finalTarget = findNearestBuilding(
+          position, _targetGroups[GROUP_DEFENSE], -1, bestDistance);
+      break;
+    case AttackType::RESOURCE:
+      finalTarget = findNearestBuilding(
+          position, _targetGroups[GROUP_RESOURCE], -1, bestDistance);
+      break;
+    case AttackType::TOWN_HALL:
+      finalTarget = findNearestBuilding(
+          position, _targetGroups[GROUP_TOWN_HALL], -1, bestDistance);
+      break;
+    case AttackType::WALL:
+      finalTarget = findNearestBuilding(position, _targetGroups[GROUP_WALL],
+                                        -1, bestDistance);
+      break;
+  }
+
+  // 2. 备选目标（非墙）：前一级没有候选时才查找，bestDistance 仍为初始值
+  if (finalTarget < 0) {
+    for (int group = 0; group < GROUP_COUNT; ++group) {
+      if (group != GROUP_WALL) {
+        finalTarget = findNearestBuilding(position, _targetGroups[group],
+                                          finalTarget, bestDistance);
+      }
+    }
+  }
+
+  // 3. 最后的选择（墙）
+  if (finalTarget < 0) {
+    finalTarget = findNearestBuilding(position, _targetGroups[GROUP_WALL], -1,
+                                      bestDistance);
+  }
+  if (finalTarget < 0) {
+    return false;
+  }
+
+  _soldiers.target[soldier] = finalTarget;
+  const BattleBuilding& target = _buildings[finalTarget];
+
+  // 如果目标在攻击范围内，直接攻击
+  if (isInRange(soldier, target)) {
+    _soldiers.state[soldier] = SoldierState::ATTACKING;
+    clearMoveTarget(soldier);
+    return true;
+  }
+
+  std::vector<BattleVec2>& path = _soldiers.path[soldier];
+  bool pathFound = false;
+  if (_soldiers.category[soldier] == SoldierCategory::LAND) {
+    // 同一目标的士兵共用流场，只沿流场下降生成路径；
+    // 炸弹人（攻击墙壁）允许穿过墙壁，使用墙壁视为可行走的流场。
+    // 从同一个子网格出发的路径相同，网格变化不影响它时直接复用
+    bool passWalls = (attackType == AttackType::WALL);
+    int attackRange = attackRangeKey(_soldiers.attackRange[soldier]);
+    int startCell = getFlowFieldCell(position);
+    const std::vector<BattleVec2>* cached =
+        startCell >= 0 ? _pathCache.find(startCell, finalTarget, passWalls,
+                                         attackRange, _grid.getVersion())
+                       : nullptr;
+    if (cached) {
+      path = *cached;
+    } else if (_pathService) {
+      // 交给寻路服务，结果在下一帧开始时取回。在此之前原地等待，
+      // 不朝目标直走穿过建筑和墙壁
+      BattlePathRequest request;
+      request.soldier = getSoldierHandle(soldier);
+      request.target = finalTarget;
+      request.passWalls = passWalls;
+      request.attackRange = attackRange;
+      request.start = position;
+      request.targetRow = target.row;
+      request.targetCol = target.col;
+      request.targetSize = target.gridCount;
+      request.priority = position.distance(target.position);
+      _pathService->submit(request);
+      clearMoveTarget(soldier);
+      _soldiers.state[soldier] = SoldierState::MOVING;
+      return true;
+    } else {
+      path = getFlowField(finalTarget, passWalls, attackRange)
+                 .tracePath(position, _projection);
+      finishLandPath(finalTarget, passWalls, attackRange, position, startCell,
+                     path);
+    }
+    if (!path.empty()) {
+      _soldiers.pathIndex[soldier] = 0;
+      setMoveTarget(soldier, path[0]);
+      pathFound = true;
+    }
+  } else {
+    // 空军单位无视地形，直接飞向目标
+    setMoveTarget(soldier, target.position);
+    pathFound = true;
+  }
+
+  if (!pathFound) {
+    breachToTarget(soldier);
+  }
+
+  _soldiers.state[soldier] = SoldierState::MOVING;
+  return true;
+}
+
+int BattleWorld::findNearestBuilding(const BattleVec2& position,
+                                     const std::vector<int>& buildings,
+                                     int best, BattleReal& bestDistance) const {
+  // 距离相同时取 id 较小的，与按 id 顺序遍历全部建筑的结果一致
+  for (int id : buildings) {
+    BattleReal distance = position.distance(_buildings[id].position);
+    if (distance < bestDistance || (distance == bestDistance && id < best)) {
+      best = id;
+      bestDistance = distance;
+    }
+  }
+  return best;
+}
+
+int BattleWorld::getTargetGroup(BuildingType type) {
+  switch (type) {
+    case BuildingType::DEFENSE:
+      return GROUP_DEFENSE;
+    case BuildingType::RESOURCE:
+      return GROUP_RESOURCE;
+    case BuildingType::TOWN_HALL:
+      return GROUP_TOWN_HALL;
+    case BuildingType::WALL:
+      return GROUP_WALL;
+    default:
+      return GROUP_OTHER;
+  }
+}
+
+void BattleWorld::removeFromTargetGroup(const BattleBuilding& building) {
+  if (building.type == BuildingType::TRAP) {
+    return;
+  }
+  // 保持升序，寻找目标时的遍历顺序不变
+  std::vector<int>& group = _targetGroups[getTargetGroup(building.type)];
+  auto it = std::lower_bound(group.begin(), group.end(), building.id);
+  if (it != group.end() && *it == building.id) {
+    group.erase(it);
+  }
+}
+
+void BattleWorld::finishLandPath(int target, bool passWalls, int attackRange,
+                                 const BattleVec2& start, int startCell,
+                                 std::vector<BattleVec2>& path) {
+  if (path.empty()) {
+    return;
+  }
+
+  // 流场路径每个子网格一个点，拉直后只保留拐角
+  BattlePathSmoother::smooth(
+      start, path, _projection,
+      passWalls ? getWallPassGrid() : BattleGridView(_grid));
+
+  // 路径终点在建筑边缘时，追加一个向建筑中心偏移的点，
+  // 确保士兵能走进攻击范围
+  const BattleBuilding& building = _buildings[target];
+  BattleVec2 lastPoint = path.back();
+  BattleVec2 dir = building.position - lastPoint;
+  if (dir.length() > 10.0f) {
+    dir.normalize();
+    path.push_back(lastPoint + dir * 20.0f);
+  }
+
+  if (startCell >= 0) {
+    BattleGridArea goalArea = BattleGoalSet::getReachArea(
+        building.row, building.col, building.gridCount,
+        BattleReal(attackRange), _projection);
+    _pathCache.store(startCell, target, passWalls, attackRange,
+                     _grid.getVersion(), start, path, _projection, goalArea);
+  }
+}
+
+void BattleWorld::breachToTarget(int soldier) {
+  BattleVec2 position = _soldiers.position(soldier);
+  std::vector<BattleVec2>& path = _soldiers.path[soldier];
+  const BattleBuilding& target = _buildings[_soldiers.target[soldier]];
+
+  // 目标被墙围住：一次加权搜索同时决定路线和要拆的墙。
+  // 拆墙的代价为拆掉它所需的时间内能走的子网格数
+  const int gridSize = _grid.getSize();
+  BattleReal dps =
+      _soldiers.attackDamage[soldier] * _soldiers.attackSpeed[soldier];
+  BattleReal cellsPerSecond = _soldiers.moveSpeed[soldier] *
+                              BattleReal(kBreachPrecision) /
+                              _projection.gridPixelLength();
+  _wallPenalty.assign(gridSize * gridSize, 0);
+  for (const BattleBuilding& building : _buildings) {
+    if (!building.isTargetable() || building.type != BuildingType::WALL) {
+      continue;
+    }
+    BattleReal seconds = kMaxBreachSeconds;
+    if (dps > 0.0f) {
+      seconds = std::min<BattleReal>(building.hp / dps, kMaxBreachSeconds);
+    }
+    int row = static_cast<int>(building.row);
+    int col = static_cast<int>(building.col);
+    if (_grid.isValid(row, col)) {
+      _wallPenalty[row * gridSize + col] =
+          BattleMath::round(seconds * cellsPerSecond * 10.0f);
+    }
+  }
+
+  int firstWall = -1;
+  path = BattlePathFinder::findBreachPath(position, target.position,
+                                          _projection, _grid, _wallGrid,
+                                          _wallPenalty, kBreachPrecision,
+                                          firstWall);
+  if (path.empty()) {
+    // 还是找不到路径，只能直走
+    setMoveTarget(soldier, target.position);
+    return;
+  }
+
+  if (firstWall >= 0) {
+    // 先走到墙前拆掉它，之后重新寻找目标
+    int wallRow = firstWall / gridSize;
+    int wallCol = firstWall % gridSize;
+    for (const BattleBuilding& building : _buildings) {
+      if (building.isTargetable() && building.type == BuildingType::WALL &&
+          static_cast<int>(building.row) == wallRow &&
+          static_cast<int>(building.col) == wallCol) {
+        _soldiers.target[soldier] = building.id;
+        break;
+      }
+    }
+    for (size_t i = 0; i < path.size(); ++i) {
+      BattleReal row, col;
+      if (_projection.screenToGrid(path[i], row, col) &&
+          static_cast<int>(row) == wallRow &&
+          static_cast<int>(col) == wallCol) {
+        path.resize(i);
+        break;
+      }
+    }
+    if (path.empty()) {
+      setMoveTarget(soldier, _buildings[_soldiers.target[soldier]].position);
+      return;
+    }
+  }
+
+  // 截断后的路径只经过可通行的网格
+  BattlePathSmoother::smooth(position, path, _projection,
+                             BattleGridView(_grid));
+  _soldiers.pathIndex[soldier] = 0;
+  setMoveTarget(soldier, path[0]);
+}
+
+void BattleWorld::enableAsyncPathfinding(int threadCount, int budget) {
+  _pathService.reset(new BattlePathService(threadCount, kFlowFieldPrecision));
+  _pathService->setBudget(budget);
+}
+
+void BattleWorld::disableAsyncPathfinding() {
+  _pathService.reset();
+  _pathResults.clear();
+}
+
+void BattleWorld::applyPathResults() {
+  _pathService->collect(_pathResults);
+  // 帧末派发后网格没有再变化时，结果可以放入寻路缓存
+  const bool gridUnchanged =
+      _pathService->getSnapshotVersion() == _grid.getVersion();
+  for (BattlePathResult& result : _pathResults) {
+    const BattlePathRequest& request = result.request;
+    if (!isSoldierValid(request.soldier)) {
+      continue;
+    }
+    // 只处理仍在原地等待这个请求的士兵，等待期间目标可能已被摧毁或更换
+    int soldier = request.soldier.index();
+    if (_soldiers.state[soldier] != SoldierState::MOVING ||
+        _soldiers.hasMoveTarget[soldier] ||
+        _soldiers.target[soldier] != request.target ||
+        !_soldiers.path[soldier].empty() || !isTargetValid(request.target)) {
+      continue;
+    }
+
+    // 从士兵当前的位置拉直路径；离开了请求时的子网格则不放入缓存
+    std::vector<BattleVec2>& path = _soldiers.path[soldier];
+    path.swap(result.path);
+    BattleVec2 position = _soldiers.position(soldier);
+    int startCell = getFlowFieldCell(position);
+    if (!gridUnchanged || startCell != getFlowFieldCell(request.start)) {
+      startCell = -1;
+    }
+    finishLandPath(request.target, request.passWalls, request.attackRange,
+                   position, startCell, path);
+    if (path.empty()) {
+      breachToTarget(soldier);
+      continue;
+    }
+    _soldiers.pathIndex[soldier] = 0;
+    setMoveTarget(soldier, path[0]);
+  }
+}
+
+bool BattleWorld::isInRange(int soldier, const BattleBuilding& building) const {
+  BattleVec2 position = _soldiers.position(soldier);
+  BattleReal attackRange = _soldiers.attackRange[soldier];
+
+  BattleReal myRow, myCol;
+  if (!_projection.screenToGrid(position, myRow, myCol)) {
+    // 无法转换坐标，回退到简单的距离判断
+    return position.distance(building.position) <= attackRange;
+  }
+  // 与寻路使用的攻击位判定相同
+  return BattleGoalSet::isInRange(position, myRow, myCol, building.row,
+                                  building.col, building.gridCount,
+                                  attackRange, _projection);
+}
+
+bool BattleWorld::isSoldierInRadius(int soldier, const BattleVec2& center,
+                                    BattleReal radius) const {
+  return _soldiers.isAlive(soldier) &&
+         _soldiers.position(soldier).distance(center) <= radius;
+}
+
+void BattleWorld::setMoveTarget(int soldier, const BattleVec2& position) {
+  _soldiers.moveTargetX[soldier] = position.x;
+  _soldiers.moveTargetY[soldier] = position.y;
+  _soldiers.hasMoveTarget[soldier] = 1;
+  if (_soldiers.state[soldier] == SoldierState::IDLE) {
+    _soldiers.state[soldier] = SoldierState::MOVING;
+  }
+}
+
+void BattleWorld::clearMoveTarget(int soldier) {
+  _soldiers.hasMoveTarget[soldier] = 0;
+  _soldiers.path[soldier].clear();
+}
+
+bool BattleWorld::isTargetValid(int buildingId) const {
+  return buildingId >= 0 &&
+         buildingId < static_cast<int>(_buildings.size()) &&
+         _buildings[buildingId].isTargetable();
+}
+
+void BattleWorld::resolveDamage() {
+  // 1. 建筑：按目标汇总后一次性扣血
+  _damage.drainBuildings(_damageTotals);
+  for (const BattleDamageEvent& total : _damageTotals) {
+    BattleBuilding& building = _buildings[total.target];
+    if (!building.isAlive()) {
+      continue;
+    }
+    building.hp -= total.amount;
+    _damageReport.damagedBuildings.push_back(building.id);
+    if (building.hp <= 0) {
+      destroyBuilding(building);
+    }
+  }
+
+  // 2. 士兵
+  _damage.drainSoldiers(_damageTotals);
+  for (const BattleDamageEvent& total : _damageTotals) {
+    int soldier = total.target;
+    if (!_soldiers.isAlive(soldier)) {
+      continue;
+    }
+    _soldiers.hp[soldier] -= total.amount;
+    if (_soldiers.hp[soldier] <= 0) {
+      killSoldier(soldier);
+    }
+  }
+
+  // 炸弹人在帧内自爆，死亡顺序按 id 重新排列
+  std::sort(_damageReport.killedSoldiers.begin(),
+            _damageReport.killedSoldiers.end());
+
+  // 3. 正在攻击被摧毁建筑的士兵回到待机状态，下一帧重新寻找目标
+  if (_damageReport.destroyedBuildings.empty()) {
+    return;
+  }
+  const int count = _soldiers.size();
+  for (int i = 0; i < count; ++i) {
+    if (_soldiers.state[i] == SoldierState::ATTACKING &&
+        !isTargetValid(_soldiers.target[i])) {
+      _soldiers.target[i] = -1;
+      _soldiers.state[i] = SoldierState::IDLE;
+    }
+  }
+}
+
+void BattleWorld::destroyBuilding(BattleBuilding& building) {
+  building.hp = 0;
+  removeFromTargetGroup(building);
+  // 建筑被摧毁，网格变为可通行
+  setGridArea(static_cast<int>(building.row), static_cast<int>(building.col),
+              building.gridCount, false);
+  if (building.type == BuildingType::WALL) {
+    _wallGrid.setArea(static_cast<int>(building.row),
+                      static_cast<int>(building.col), 1, false);
+  }
+  _damageReport.destroyedBuildings.push_back(building.id);
+
+  // 不会再有士兵以它为目标
+  _flowFields.erase(
+      _flowFields.lower_bound(FlowFieldKey(building.id, false, 0)),
+      _flowFields.lower_bound(FlowFieldKey(building.id + 1, false, 0)));
+  _pathCache.eraseBuilding(building.id);
+}
+
+void BattleWorld::setGridArea(int row, int col, int size, bool blocked) {
+  unsigned previousVersion = _grid.getVersion();
+  _grid.setArea(row, col, size, blocked);
+  _pathCache.invalidate(BattleGridArea::around(row, col, size), blocked,
+                        previousVersion, _grid.getVersion());
+
+  _gridChanges.emplace_back(_grid.getVersion(),
+                            BattleGridArea::around(row, col, size));
+  if (_gridChanges.size() > kMaxGridChanges) {
+    _gridChanges.erase(_gridChanges.begin());
+  }
+}
+
+BattleGridView BattleWorld::getWallPassGrid() const {
+  return BattleGridView(_grid, &_wallGrid);
+}
+
+int BattleWorld::getFlowFieldCell(const BattleVec2& position) const {
+  // 与 BattleFlowField::tracePath 选取起点的方式相同
+  BattleReal row, col;
+  if (!_projection.screenToGrid(position, row, col)) {
+    return -1;
+  }
+  const int size = _grid.getSize() * kFlowFieldPrecision;
+  int r = std::min(std::max(BattleMath::round(row * kFlowFieldPrecision), 0),
+                   size - 1);
+  int c = std::min(std::max(BattleMath::round(col * kFlowFieldPrecision), 0),
+                   size - 1);
+  return r * size + c;
+}
+
+const BattleFlowField& BattleWorld::getFlowField(int buildingId,
+                                                 bool passWalls,
+                                                 int attackRange) {
+  FlowFieldEntry& entry =
+      _flowFields[FlowFieldKey(buildingId, passWalls, attackRange)];
+  if (entry.built && entry.gridVersion == _grid.getVersion()) {
+    return entry.field;
+  }
+
+  // 流场之后的变化都有记录时尝试局部修复（墙壁、建筑被摧毁），
+  // 有阻挡增加或记录不全时重新构建。
+  // 攻击位只在变化区域靠近目标时重新计算
+  const BattleBuilding& building = _buildings[buildingId];
+  BattleGridArea reach = BattleGoalSet::getReachArea(
+      building.row, building.col, building.gridCount, BattleReal(attackRange),
+      _projection);
+  bool complete = false;
+  bool goalsChanged = !entry.built;
+  if (entry.built) {
+    _changedAreas.clear();
+    for (const auto& change : _gridChanges) {
+      if (change.first > entry.gridVersion) {
+        _changedAreas.push_back(change.second);
+        goalsChanged = goalsChanged || change.second.intersects(reach);
+      }
+    }
+    complete =
+        _changedAreas.size() == _grid.getVersion() - entry.gridVersion;
+  }
+  BattleGridView grid = passWalls ? getWallPassGrid() : BattleGridView(_grid);
+  if (goalsChanged || !complete) {
+    entry.goals.build(building.row, building.col, building.gridCount,
+                      BattleReal(attackRange), _projection, grid,
+                      kFlowFieldPrecision);
+  }
+  if (!complete || !entry.field.repair(grid, _changedAreas, entry.goals)) {
+    entry.field.build(entry.goals, grid);
+  }
+  entry.gridVersion = _grid.getVersion();
+  entry.built = true;
+  return entry.field;
+}
+
+void BattleWorld::killSoldier(int soldier) {
+  _soldiers.hp[soldier] = 0;
+  _soldiers.state[soldier] = SoldierState::DEAD;
+  _soldiers.target[soldier] = -1;
+  _damageReport.killedSoldiers.push_back(soldier);
+
+  // 释放槽位，指向该士兵的句柄随之失效
+  _soldierHandles.release(_soldierHandles.handleAt(soldier));
+}
+
+void BattleWorld::applySpell(BattleSpell& spell) {
+  BattleReal radius = spell.stats.radius;
+
+  switch (spell.type) {
+    case SpellType::LIGHTNING:
+      // 对范围内的建筑造成伤害
+      for (BattleBuilding& building : _buildings) {
+        if (building.isTargetable() &&
+            building.position.distance(spell.position) <= radius) {
+          _damage.addBuildingDamage(building.id, spell.stats.amount);
+        }
+      }
+      break;
+
+    case SpellType::HEAL:
+      // 瞬时治疗立即生效，持续治疗在 updateSpell 中处理
+      if (spell.stats.category == SpellCategory::INSTANT) {
+        _soldierGrid.forEachNear(spell.position, radius, [&](int i) {
+          if (isSoldierInRadius(i, spell.position, radius)) {
+            _soldiers.hp[i] =
+                std::min(_soldiers.hp[i] + spell.stats.amount,
+                         _soldiers.maxHP[i]);
+          }
+        });
+      }
+      break;
+
+    case SpellType::RAGE:
+      _soldierGrid.forEachNear(spell.position, radius, [&](int i) {
+        if (isSoldierInRadius(i, spell.position, radius)) {
+          applyRage(spell, i);
+        }
+      });
+      break;
+  }
+}
+
+void BattleWorld::updateSpell(BattleSpell& spell, BattleReal dt) {
+  if (!spell.active) {
+    return;
+  }
+
+  spell.elapsed += dt;
+
+  if (spell.stats.category != SpellCategory::DURATION) {
+    // 瞬时效果，留一点时间显示视觉效果后结束
+    if (spell.elapsed > 0.1f) {
+      endSpell(spell);
+    }
+    return;
+  }
+
+  if (spell.elapsed >= spell.stats.duration) {
+    endSpell(spell);
+    return;
+  }
+
+  BattleReal radius = spell.stats.radius;
+  if (spell.type == SpellType::HEAL) {
+    BattleReal healAmount = spell.healPerSecond * dt;
+    _soldierGrid.forEachNear(spell.position, radius, [&](int i) {
+      if (isSoldierInRadius(i, spell.position, radius)) {
+        _soldiers.hp[i] =
+            std::min(_soldiers.hp[i] + healAmount, _soldiers.maxHP[i]);
+      }
+    });
+  } else if (spell.type == SpellType::RAGE) {
+    // 对新进入范围的士兵应用效果
+    _soldierGrid.forEachNear(spell.position, radius, [&](int i) {
+      if (isSoldierInRadius(i, spell.position, radius)) {
+        applyRage(spell, i);
+      }
+    });
+
+    // 离开范围或死亡的士兵移除效果
+    auto it = spell.ragedSoldiers.begin();
+    while (it != spell.ragedSoldiers.end()) {
+      bool alive = _soldierHandles.isValid(*it);
+      int soldier = it->index();
+      if (!alive || !isSoldierInRadius(soldier, spell.position, radius)) {
+        if (alive) {
+          removeRage(spell, soldier);
+        }
+        it = spell.ragedSoldiers.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+}
+
+void BattleWorld::endSpell(BattleSpell& spell) {
+  spell.active = false;
+  _spellHandles.release(_spellHandles.handleAt(spell.id));
+
+  // 恢复所有受狂暴影响士兵的属性（槽位已被复用的士兵不受影响）
+  for (BattleHandle handle : spell.ragedSoldiers) {
+    if (_soldierHandles.isValid(handle)) {
+      removeRage(spell, handle.index());
+    }
+  }
+  spell.ragedSoldiers.clear();
+}
+
+void BattleWorld::applyRage(BattleSpell& spell, int soldier) {
+  BattleHandle handle = _soldierHandles.handleAt(soldier);
+  if (std::find(spell.ragedSoldiers.begin(), spell.ragedSoldiers.end(),
+                handle) != spell.ragedSoldiers.end()) {
+    return;
+  }
+
+  BattleReal ratio = spell.stats.ratio;
+  _soldiers.moveSpeed[soldier] *= ratio;
+  _soldiers.attackSpeed[soldier] *= ratio;
+  _soldiers.attackDamage[soldier] *= ratio;
+  spell.ragedSoldiers.push_back(handle);
+}
+
+void BattleWorld::removeRage(const BattleSpell& spell, int soldier) {
+  BattleReal ratio = spell.stats.ratio;
+  _soldiers.moveSpeed[soldier] /= ratio;
+  _soldiers.attackSpeed[soldier] /= ratio;
+  _soldiers.attackDamage[soldier] /= ratio;
+}
+
+void BattleWorld::updateDefense(BattleBuilding& building, BattleReal dt) {
+  if (building.attackCooldown > 0.0f) {
+    building.attackCooldown -= dt;
+  }
+
+  // 找到攻击范围内最近的存活士兵，距离相同时取 id 较小的
+  int nearestTarget = -1;
+  BattleReal nearestDistance = BattleMath::maxValue();
+  const BattleReal range = building.defenseRange;
+  _soldierGrid.forEachNear(building.position, range, [&](int i) {
+    if (!_soldiers.isAlive(i)) {
+      return;
+    }
+    BattleReal distance = building.position.distance(_soldiers.position(i));
+    if (distance <= range &&
+        (distance < nearestDistance ||
+         (distance == nearestDistance && i < nearestTarget))) {
+      nearestDistance = distance;
+      nearestTarget = i;
+    }
+  });
+
+  building.targetSoldier = _soldierHandles.handleAt(nearestTarget);
+  if (nearestTarget < 0 || building.attackCooldown > 0.0f) {
+    return;
+  }
+
+  _damage.addSoldierDamage(nearestTarget,
+                           static_cast<BattleReal>(building.damage));
+
+  // 攻击速度是每秒攻击次数，冷却时间为其倒数
+  building.attackCooldown =
+      (building.attackSpeed > 0.0f) ? (1.0f / building.attackSpeed) : 1.0f;
+}
+
+void BattleWorld::updateTrap(BattleBuilding& trap) {
+  bool triggered = false;
+  _soldierGrid.forEachNear(trap.position, trap.triggerRange, [&](int i) {
+    triggered = triggered || isSoldierInRadius(i, trap.position,
+                                               trap.triggerRange);
+  });
+  if (!triggered) {
+    return;
+  }
+
+  // 标记为已触发，防止重复爆炸
+  trap.armed = false;
+
+  // 爆炸范围略大于触发范围
+  BattleReal damageRadius = trap.triggerRange * 1.5f;
+  _soldierGrid.forEachNear(trap.position, damageRadius, [&](int i) {
+    if (isSoldierInRadius(i, trap.position, damageRadius)) {
+      _damage.addSoldierDamage(i, static_cast<BattleReal>(trap.damage));
+    }
+  });
+}
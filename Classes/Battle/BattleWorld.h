@@ -0,0 +1,215 @@
+#ifndef __BATTLE_WORLD_H__
+#define __BATTLE_WORLD_H__
+
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "Battle/BattleDamageBuffer.h"
+#include "Battle/BattleEntities.h"
+#include "Battle/BattleFlowField.h"
+#include "Battle/BattleGoalSet.h"
+#include "Battle/BattleGrid.h"
+#include "Battle/BattleHandle.h"
+#include "Battle/BattlePathCache.h"
+#include "Battle/BattlePathService.h"
+#include "Battle/BattleSoldierGrid.h"
+
+/**
+ * 无头战斗世界
+ * 持有一场战斗中的全部建筑、士兵和法术，并推进战斗逻辑。
+ * 不依赖 cocos2d：游戏中由 BattleManager 驱动并同步到精灵，
+ * 也可以在没有渲染环境的服务器上直接运行
+ */
+class BattleWorld {
+ public:
+  /**
+   * 构造函数
+   * @param projection 网格投影参数（地图原点、网格间距）
+   */
+  explicit BattleWorld(const BattleProjection& projection);
+
+  /**
+   * 添加建筑
+   * @param name 建筑名称（如 "Cannon"）
+   * @param level 建筑等级
+   * @param stats 建筑属性
+   * @param row 中心行坐标
+   * @param col 中心列坐标
+   * @param hp 当前生命值，如果 < 0 则使用 maxHP
+   * @return 建筑 id
+   */
+  int addBuilding(const std::string& name, int level,
+                  const BattleBuildingStats& stats, BattleReal row,
+                  BattleReal col, BattleReal hp = -1.0f);
+
+  /**
+   * 在指定位置放置士兵
+   * 死亡士兵的槽位会被之后部署的士兵复用，跨帧引用士兵时应保存句柄
+   * @return 士兵 id（槽位）
+   */
+  int addSoldier(SoldierType type, int level, const BattleSoldierStats& stats,
+                 const BattleVec2& position);
+
+  /**
+   * 在指定位置施放法术
+   * 已结束法术的槽位会被之后施放的法术复用
+   * @return 法术 id（槽位）
+   */
+  int castSpell(SpellType type, const BattleSpellStats& stats,
+                const BattleVec2& position);
+
+  /**
+   * 推进战斗
+   * 依次更新士兵、法术、防御建筑和陷阱；
+   * 士兵的冷却和移动按结构数组批量计算。
+   * 本帧产生的伤害（包括上一帧之后施放的雷电）在帧末统一结算
+   * @param dt 时间间隔（秒）
+   */
+  void update(BattleReal dt);
+
+  /**
+   * 移除所有士兵和法术（建筑保持当前状态）
+   */
+  void clearUnits();
+
+  /**
+   * 地面士兵改为异步寻路（默认在寻找目标时同步寻路）
+   * 请求在帧末派发、下一帧开始时生效，等待期间士兵先朝目标直走
+   * @param threadCount 工作线程数，0 表示在帧末直接计算
+   * @param budget 每帧最多处理的请求数，<= 0 表示不限
+   */
+  void enableAsyncPathfinding(int threadCount, int budget);
+  void disableAsyncPathfinding();
+  bool isAsyncPathfinding() const { return _pathService != nullptr; }
+
+  /**
+   * 计算当前的战斗结果（城墙不计入）
+   * @return 没有可计入的建筑时返回 false
+   */
+  bool getResult(BattleResult& result) const;
+
+  /**
+   * 是否还有存活的士兵
+   */
+  bool hasLivingSoldiers() const;
+
+  const std::vector<BattleBuilding>& getBuildings() const { return _buildings; }
+  const BattleSoldierArray& getSoldiers() const { return _soldiers; }
+  const std::vector<BattleSpell>& getSpells() const { return _spells; }
+  const BattleGrid& getGrid() const { return _grid; }
+  const BattleProjection& getProjection() const { return _projection; }
+
+  /**
+   * 士兵句柄：槽位被复用后旧句柄失效
+   */
+  BattleHandle getSoldierHandle(int soldier) const {
+    return _soldierHandles.handleAt(soldier);
+  }
+  bool isSoldierValid(BattleHandle handle) const {
+    return _soldierHandles.isValid(handle);
+  }
+
+  /**
+   * 最近一次 update 结算的伤害结果
+   */
+  const BattleDamageReport& getDamageReport() const { return _damageReport; }
+
+ private:
+  // 士兵（参数均为士兵 id）
+  void updateSoldiers(BattleReal dt);
+  void updateSoldierState(int soldier, BattleReal dt);
+  void prepareMove(int soldier);
+  void afterMove(int soldier);
+  void soldierAttack(int soldier, BattleReal dt);
+  void bomberAttack(int soldier, BattleReal dt);
+  bool findTarget(int soldier);
+  int findNearestBuilding(const BattleVec2& position,
+                          const std::vector<int>& buildings, int best,
+                          BattleReal& bestDistance) const;
+  bool isInRange(int soldier, const BattleBuilding& building) const;
+  bool isSoldierInRadius(int soldier, const BattleVec2& center,
+                         BattleReal radius) const;
+  BattleGridView getWallPassGrid() const;
+  const BattleFlowField& getFlowField(int buildingId, bool passWalls,
+                                      int attackRange);
+  int getFlowFieldCell(const BattleVec2& position) const;
+  void finishLandPath(int target, bool passWalls, int attackRange,
+                      const BattleVec2& start, int startCell,
+                      std::vector<BattleVec2>& path);
+  void breachToTarget(int soldier);
+  void applyPathResults();
+  void setMoveTarget(int soldier, const BattleVec2& position);
+  void clearMoveTarget(int soldier);
+  bool isTargetValid(int buildingId) const;
+
+  // 可作为目标的建筑（存活、非陷阱）按类别分组，寻找目标时只检查
+  // 攻击偏好对应的分组
+  enum TargetGroup {
+    GROUP_DEFENSE,
+    GROUP_RESOURCE,
+    GROUP_TOWN_HALL,
+    GROUP_WALL,
+    GROUP_OTHER,  // 储存建筑、兵营等
+    GROUP_COUNT
+  };
+  static int getTargetGroup(BuildingType type);
+  void removeFromTargetGroup(const BattleBuilding& building);
+
+  // 伤害
+  void resolveDamage();
+  void destroyBuilding(BattleBuilding& building);
+  void setGridArea(int row, int col, int size, bool blocked);
+  void killSoldier(int soldier);
+
+  // 法术
+  void applySpell(BattleSpell& spell);
+  void updateSpell(BattleSpell& spell, BattleReal dt);
+  void endSpell(BattleSpell& spell);
+  void applyRage(BattleSpell& spell, int soldier);
+  void removeRage(const BattleSpell& spell, int soldier);
+
+  // 防御
+  void updateDefense(BattleBuilding& building, BattleReal dt);
+  void updateTrap(BattleBuilding& trap);
+
+  BattleProjection _projection;
+  BattleGrid _grid;
+  BattleGrid _wallGrid;  // 存活的墙壁，叠加在 _grid 上得到炸弹人穿墙的网格
+  std::vector<int> _wallPenalty;  // 破墙寻路时每段墙的代价，按网格下标
+
+  // 按（目标建筑，是否穿墙，攻击范围）缓存的攻击位和流场，
+  // 网格变化后在下次使用时修复或重建
+  typedef std::tuple<int, bool, int> FlowFieldKey;
+  struct FlowFieldEntry {
+    BattleGoalSet goals;
+    BattleFlowField field;
+    unsigned gridVersion = 0;
+    bool built = false;
+  };
+  std::map<FlowFieldKey, FlowFieldEntry> _flowFields;
+  // 最近的网格变化（变化后的版本，区域），用于局部修复流场
+  std::vector<std::pair<unsigned, BattleGridArea>> _gridChanges;
+  std::vector<BattleGridArea> _changedAreas;
+  BattlePathCache _pathCache;  // 地面士兵的寻路结果
+  std::unique_ptr<BattlePathService> _pathService;  // 为空时同步寻路
+  std::vector<BattlePathResult> _pathResults;
+  std::vector<BattleBuilding> _buildings;
+  std::vector<int> _targetGroups[GROUP_COUNT];  // 建筑 id，按升序排列
+  BattleSoldierArray _soldiers;
+  BattleSoldierGrid _soldierGrid;  // 存活士兵的空间哈希，每帧移动后重建
+  BattleReal _soldierCellSize = 0;  // 空间哈希的格子边长（像素）
+  std::vector<BattleSpell> _spells;
+
+  BattleHandleRegistry _soldierHandles;  // 存活士兵的槽位
+  BattleHandleRegistry _spellHandles;    // 生效中法术的槽位
+
+  BattleDamageBuffer _damage;                    // 本帧待结算的伤害
+  BattleDamageReport _damageReport;              // 上一次结算的结果
+  std::vector<BattleDamageEvent> _damageTotals;  // 结算用的临时数组
+};
+
+#endif  // __BATTLE_WORLD_H__
@@ -20,12 +20,8 @@
 #endif
 
 #include "Container/Scene/SenceHelper.h"
-#include "Game/Building/DefenseBuilding.h"
 #include "Game/Building/TrapBuilding.h"
-#include "Game/Soldier/BasicSoldier.h"
-#include "Game/Spell/HealSpell.h"
-#include "Game/Spell/LightningSpell.h"
-#include "Game/Spell/RageSpell.h"
+#include "Manager/Battle/BattleManager.h"
 #include "Manager/Record/RecordManager.h"
 #include "Manager/Troop/TroopManager.h"
 #include "Utils/AudioManager.h"
@@ -83,6 +79,7 @@ bool AttackScene::init(const std::string& jsonFilePath) {
   _selectedSpellIndex = -1;
   _statusBarLayer = nullptr;
   _troopManager = nullptr;
+  _battleManager = nullptr;
   _troopIconBgs.clear();
   _spellIconBgs.clear();
   _isAttackStarted = false;
@@ -107,6 +104,14 @@ bool AttackScene::init(const std::string& jsonFilePath) {
     }
   }
 
+  // 创建并初始化 BattleManager（注册地图中的所有建筑）
+  _battleManager =
+      new (std::nothrow) BattleManager(_buildingManager, _mapLayer, _p00);
+  if (!_battleManager || !_battleManager->init()) {
+    CC_SAFE_DELETE(_battleManager);
+    return false;
+  }
+
   // 创建并初始化 TroopManager
   _troopManager = new (std::nothrow) TroopManager();
   if (!_troopManager || !_troopManager->init()) {
@@ -117,6 +122,14 @@ bool AttackScene::init(const std::string& jsonFilePath) {
   _troopItems = _troopManager->getTroopItems();
   _spellItems = _troopManager->getSpellItems();
 
+  // 按携带的军队数量预先创建士兵精灵，拖动连续部署时不再逐个加载
+  for (const auto& t : _troopItems) {
+    SoldierType soldierType = SoldierType::BARBARIAN;
+    if (BattleTypeUtils::parseSoldierType(t.soldierType, soldierType)) {
+      _battleManager->prewarmSoldiers(soldierType, t.level, t.count);
+    }
+  }
+
   // 预加载图标纹理，避免在选择或重建状态栏时出现卡顿
   auto texCache = Director::getInstance()->getTextureCache();
   for (const auto& t : _troopItems) {
@@ -595,52 +608,15 @@ void AttackScene::cancelPlacementMode() {
 }
 
 void AttackScene::placeSoldier(const Vec2& worldPos, const TroopItem& item) {
-  if (_isEnd) return;
+  if (_isEnd || !_battleManager) return;
   // 转换士兵类型字符串为枚举
   SoldierType soldierType = SoldierType::BARBARIAN;
-  if (item.soldierType == "barbarian") {
-    soldierType = SoldierType::BARBARIAN;
-  } else if (item.soldierType == "archer") {
-    soldierType = SoldierType::ARCHER;
-  } else if (item.soldierType == "giant") {
-    soldierType = SoldierType::GIANT;
-  } else if (item.soldierType == "bomber") {
-    soldierType = SoldierType::BOMBER;
-  } else if (item.soldierType == "dragon") {
-    soldierType = SoldierType::DRAGON;
-  }
+  BattleTypeUtils::parseSoldierType(item.soldierType, soldierType);
 
   // 创建士兵
-  auto soldier = BasicSoldier::create(soldierType, item.level);
+  auto soldier =
+      _battleManager->deploySoldier(soldierType, item.level, worldPos);
   if (soldier) {
-    soldier->setPosition(worldPos);
-    _mapLayer->addChild(soldier, 5);
-    _placedSoldiers.push_back(soldier);
-
-    // 设置建筑查找回调
-    soldier->setBuildingFinderCallback([this]() {
-      std::vector<Building*> buildings;
-      if (_buildingManager) {
-        const auto& allBuildings = _buildingManager->getAllBuildings();
-        // 只返回存活的建筑
-        for (Building* building : allBuildings) {
-          if (building && building->isVisible() && building->isAlive()) {
-            buildings.push_back(building);
-          }
-        }
-      }
-      return buildings;
-    });
-
-    // 设置网格状态回调
-    soldier->setP00(_p00);
-    soldier->setGridStatusCallback([this](int row, int col) {
-      if (_buildingManager) {
-        return _buildingManager->isWalkable(row, col);
-      }
-      return true;  // 默认可通行
-    });
-
     // 通过 TroopManager 减少数量
     if (_troopManager) {
       if (!_troopManager->consumeTroop(item.soldierType, item.level)) {
@@ -669,106 +645,52 @@ void AttackScene::placeSoldier(const Vec2& worldPos, const TroopItem& item) {
     if (_recordManager) {
       int timestamp = _recordManager->getCurrentTimestamp();
       _recordManager->recordTroopPlacement(item.soldierType, item.level,
-                                           worldPos.x, worldPos.y, timestamp);
+                                           worldPos.x, worldPos.y, timestamp,
+                                           _battleManager->getTick());
     }
   }
 }
 
 void AttackScene::castSpell(const Vec2& worldPos, const SpellItem& item) {
-  if (_isEnd) return;
+  if (_isEnd || !_battleManager) return;
   // 转换法术类型字符串为枚举
   SpellType spellType = SpellType::HEAL;
-  if (item.spellType == "Heal") {
-    spellType = SpellType::HEAL;
-  } else if (item.spellType == "Lightning") {
-    spellType = SpellType::LIGHTNING;
-  } else if (item.spellType == "Rage") {
-    spellType = SpellType::RAGE;
-  }
-
-  // 创建法术
-  BasicSpell* spell = nullptr;
-  switch (spellType) {
-    case SpellType::HEAL:
-      spell = HealSpell::create();
-      break;
-    case SpellType::LIGHTNING:
-      spell = LightningSpell::create();
-      break;
-    case SpellType::RAGE:
-      spell = RageSpell::create();
-      break;
-  }
+  BattleTypeUtils::parseSpellType(item.spellType, spellType);
 
+  // 施放法术
+  auto spell = _battleManager->castSpell(spellType, worldPos);
   if (spell) {
-    // 设置目标查找回调
-    spell->setSoldierFinderCallback([this]() { return _placedSoldiers; });
-    spell->setBuildingFinderCallback([this]() {
-      // 从 BuildingManager 获取建筑列表
-      std::vector<Building*> buildings;
-      if (_buildingManager) {
-        const auto& allBuildings = _buildingManager->getAllBuildings();
-        // 只返回存活的建筑
-        for (Building* building : allBuildings) {
-          if (building && building->isVisible() && building->isAlive()) {
-            buildings.push_back(building);
-          }
-        }
-      }
-      return buildings;
-    });
-
-    // 获取所有建筑（用于cast方法）
-    std::vector<Building*> buildings;
-    if (_buildingManager) {
-      const auto& allBuildings = _buildingManager->getAllBuildings();
-      // 只返回存活的建筑
-      for (Building* building : allBuildings) {
-        if (building && building->isVisible() && building->isAlive()) {
-          buildings.push_back(building);
-        }
+    // 通过 TroopManager 减少数量
+    if (_troopManager) {
+      if (!_troopManager->consumeSpell(item.spellType)) {
+        cancelPlacementMode();
       }
-    }
 
-    // 施放法术
-    if (spell->cast(worldPos, _placedSoldiers, buildings)) {
-      _mapLayer->addChild(spell, 8);
-      _activeSpells.push_back(spell);
-
-      // 通过 TroopManager 减少数量
-      if (_troopManager) {
-        if (!_troopManager->consumeSpell(item.spellType)) {
-          cancelPlacementMode();
-        }
-
-        // 更新本地列表
-        _spellItems = _troopManager->getSpellItems();
+      // 更新本地列表
+      _spellItems = _troopManager->getSpellItems();
 
-        // 更新数量标签（避免重建整个状态栏）
-        for (size_t idx = 0;
-             idx < _spellCountLabels.size() && idx < _spellItems.size();
-             ++idx) {
-          if (_spellCountLabels[idx] && _spellCountLabels[idx]->getParent()) {
-            _spellCountLabels[idx]->setString(
-                std::to_string(_spellItems[idx].count));
-          }
+      // 更新数量标签（避免重建整个状态栏）
+      for (size_t idx = 0;
+           idx < _spellCountLabels.size() && idx < _spellItems.size();
+           ++idx) {
+        if (_spellCountLabels[idx] && _spellCountLabels[idx]->getParent()) {
+          _spellCountLabels[idx]->setString(
+              std::to_string(_spellItems[idx].count));
         }
       }
+    }
 
-      // 如果进攻尚未开始，则自动开始
-      if (!_isAttackStarted) {
-        startAttack();
-      }
-
-      // 记录法术布置
-      if (_recordManager) {
-        int timestamp = _recordManager->getCurrentTimestamp();
-        _recordManager->recordSpellPlacement(item.spellType, worldPos.x,
-                                             worldPos.y, timestamp);
-      }
+    // 如果进攻尚未开始，则自动开始
+    if (!_isAttackStarted) {
+      startAttack();
+    }
 
-    } else {
-      CC_SAFE_DELETE(spell);
+    // 记录法术布置
+    if (_recordManager) {
+      int timestamp = _recordManager->getCurrentTimestamp();
+      _recordManager->recordSpellPlacement(item.spellType, worldPos.x,
+                                           worldPos.y, timestamp,
+                                           _battleManager->getTick());
     }
   }
 }
@@ -1162,17 +1084,9 @@ void AttackScene::startAttack() {
     _recordManager->startAttack();
   }
 
-  // 启动倒计时更新
-  this->schedule([this](float dt) { this->updateCountdown(dt); }, 1.0f,
-                 "updateCountdown");
-
-  // 启动防御建筑攻击更新（每帧更新，使用 0.0f 表示每帧调用）
-  this->schedule([this](float dt) { this->updateDefenseBuildings(dt); }, 0.0f,
-                 "updateDefenseBuildings");
-
-  // 启动陷阱检测更新 (每 0.1 秒检查一次)
-  this->schedule([this](float dt) { this->updateTraps(dt); }, 0.1f,
-                 "updateTraps");
+  // 启动战斗更新（每帧更新，使用 0.0f 表示每帧调用，倒计时随战斗时钟更新）
+  this->schedule([this](float dt) { this->updateBattle(dt); }, 0.0f,
+                 "updateBattle");
 
   CCLOG("Attack started, countdown: %d seconds", _countdownSeconds);
 }
@@ -1185,14 +1099,8 @@ void AttackScene::endAttack() {
     _buildingManager->updateClansWar(_clans_id, _map_id);
   }
   _isEnd = true;
-  // 停止倒计时
-  this->unschedule("updateCountdown");
-
-  // 停止防御建筑攻击更新
-  this->unschedule("updateDefenseBuildings");
-
-  // 停止陷阱检测
-  this->unschedule("updateTraps");
+  // 停止战斗更新（包括倒计时）
+  this->unschedule("updateBattle");
 
   // 保存记录
   if (_recordManager) {
@@ -1234,23 +1142,11 @@ void AttackScene::endAttack() {
   _countdownSeconds = ATTACK_DURATION;
 
   // [修复] 停止所有士兵和法术的行动
-  for (auto soldier : _placedSoldiers) {
-    if (soldier) {
-      // 停止更新，使其冻结在原地
-      soldier->unscheduleUpdate();
-      // 可选：播放待机动画或移除
-    }
+  // 战斗更新已停止，士兵冻结在原地；法术表现直接移除
+  if (_battleManager) {
+    _battleManager->clearUnits();
   }
 
-  // 停止所有法术效果
-  for (auto spell : _activeSpells) {
-    if (spell) {
-      spell->unscheduleUpdate();
-      spell->removeFromParent();  // 法术通常是瞬时或持续效果，结束后应移除
-    }
-  }
-  _activeSpells.clear();
-
   // 更新按钮状态
   if (_startAttackButton) {
     _startAttackButton->setEnabled(true);
@@ -1267,15 +1163,20 @@ void AttackScene::endAttack() {
   CCLOG("Attack ended, records saved");
 }
 
-void AttackScene::updateCountdown(float dt) {
-  if (!_isAttackStarted) {
+void AttackScene::updateCountdown() {
+  if (!_isAttackStarted || !_battleManager) {
     return;
   }
 
-  _countdownSeconds--;
-  if (_countdownSeconds < 0) {
-    _countdownSeconds = 0;
+  int remaining =
+      ATTACK_DURATION - static_cast<int>(_battleManager->getBattleTime());
+  if (remaining < 0) {
+    remaining = 0;
   }
+  if (remaining == _countdownSeconds) {
+    return;
+  }
+  _countdownSeconds = remaining;
 
   // 更新倒计时标签
   if (_countdownLabel) {
@@ -1301,100 +1202,26 @@ std::string AttackScene::formatTime(int seconds) const {
   return std::string(buffer);
 }
 
-void AttackScene::updateDefenseBuildings(float delta) {
-  // 如果攻击未开始，不更新防御建筑
-  if (!_isAttackStarted) {
-    return;
-  }
-
-  // 如果没有建筑管理器或没有士兵，直接返回
-  if (!_buildingManager || _placedSoldiers.empty()) {
-    return;
-  }
-
-  // 获取所有建筑
-  const auto& allBuildings = _buildingManager->getAllBuildings();
-
-  // 遍历所有建筑，找到防御建筑并更新攻击
-  for (Building* building : allBuildings) {
-    if (!building || !building->isVisible() || !building->isAlive()) {
-      continue;
-    }
-
-    // 检查是否为防御建筑
-    if (building->getBuildingType() != BuildingType::DEFENSE) {
-      continue;
-    }
-
-    // 转换为防御建筑
-    DefenseBuilding* defenseBuilding = dynamic_cast<DefenseBuilding*>(building);
-    if (!defenseBuilding) {
-      continue;
-    }
-
-    // 根据建筑名称决定攻击类别
-    // 默认攻击所有类别，可以根据需要扩展
-    std::vector<SoldierCategory> targetCategories = {SoldierCategory::LAND,
-                                                     SoldierCategory::AIR};
-
-    // 可以根据建筑名称设置不同的攻击类别
-    // 例如：防空火箭只攻击空军，加农炮只攻击陆军等
-    // 这里先实现攻击所有类别，后续可以根据配置扩展
-    // 如果 targetCategories 为空，attackSoldiers 会攻击所有类别
-
-    // 调用防御建筑的攻击方法
-    defenseBuilding->attackSoldiers(_placedSoldiers, targetCategories, delta);
-  }
-}
-
-// 陷阱检测更新函数
-void AttackScene::updateTraps(float delta) {
-  if (!_isAttackStarted || !_buildingManager || _placedSoldiers.empty()) {
+void AttackScene::updateBattle(float delta) {
+  // 如果攻击未开始，不推进战斗
+  if (!_isAttackStarted || !_battleManager) {
     return;
   }
 
-  const auto& allBuildings = _buildingManager->getAllBuildings();
-
-  // 遍历所有建筑
-  for (Building* building : allBuildings) {
-    // 筛选出存活的陷阱建筑
-    if (building && building->getBuildingType() == BuildingType::TRAP &&
-        building->isAlive()) {
-      TrapBuilding* trap = dynamic_cast<TrapBuilding*>(building);
-      // 只有处于布防状态（未爆炸）的陷阱才需要检查
-      if (trap && trap->getIsArmed()) {
-        // 如果检测到触发，trap 内部会处理伤害、显形和特效
-        trap->checkTrigger(_placedSoldiers);
-      }
-    }
-  }
+  _battleManager->update(delta);
+  updateCountdown();
 }
 
 AttackScene::~AttackScene() {
   cancelPlacementMode();
 
-  // 停止倒计时
+  // 停止战斗更新
   if (_isAttackStarted) {
-    this->unschedule("updateCountdown");
-    this->unschedule("updateDefenseBuildings");
+    this->unschedule("updateBattle");
   }
 
-  // 清理士兵和法术
-  // for (auto soldier : _placedSoldiers) {
-  //   if (soldier) {
-  //     soldier->removeFromParent();
-  //   }
-  // }
-  // _placedSoldiers.clear();
-
-  // for (auto spell : _activeSpells) {
-  //   if (spell) {
-  //     spell->removeFromParent();
-  //   }
-  // }
-  // _activeSpells.clear();
-
   // 清理管理器
+  CC_SAFE_DELETE(_battleManager);
   CC_SAFE_DELETE(_troopManager);
   CC_SAFE_DELETE(_recordManager);
 }
@@ -5,10 +5,7 @@
 #include <vector>
 
 #include "Container/Scene/Basic/BasicScene.h"
-#include "Game/Building/DefenseBuilding.h"
-#include "Game/Building/TrapBuilding.h"
-#include "Game/Soldier/BasicSoldier.h"
-#include "Game/Spell/BasicSpell.h"
+#include "Manager/Battle/BattleManager.h"
 #include "Manager/Record/RecordManager.h"
 #include "Manager/Troop/TroopManager.h"
 #include "ui/CocosGUI.h"
@@ -108,8 +105,9 @@ class AttackScene : public BasicScene {
   void showResult();
   /**
    * 倒计时更新函数
+   * 剩余时间由战斗时钟的模拟时间计算，与帧率无关
    */
-  void updateCountdown(float dt);
+  void updateCountdown();
 
   /**
    * 格式化倒计时时间显示
@@ -117,16 +115,11 @@ class AttackScene : public BasicScene {
   std::string formatTime(int seconds) const;
 
   /**
-   * 更新防御建筑攻击（每帧调用）
+   * 推进战斗（每帧调用）
+   * 由 BattleManager 结算士兵、法术、防御建筑和陷阱
    * @param delta 时间间隔
    */
-  void updateDefenseBuildings(float delta);
-
-  /**
-   * 更新陷阱检测（每帧调用）
-   * 检测是否有士兵触发陷阱
-   */
-  void updateTraps(float delta);
+  void updateBattle(float delta);
 
   /**
    * 更新记录摘要文件 record/summary.json
@@ -162,8 +155,7 @@ class AttackScene : public BasicScene {
       _troopCountLabels;  // 士兵数量标签（与 _troopIconBgs 对应）
   std::vector<Label*>
       _spellCountLabels;  // 法术数量标签（与 _spellIconBgs 对应）
-  std::vector<BasicSoldier*> _placedSoldiers;  // 已布置的士兵列表
-  std::vector<BasicSpell*> _activeSpells;      // 活跃的法术列表
+  BattleManager* _battleManager = nullptr;  // 战斗管理器实例
 
   // 进攻控制相关
   cocos2d::ui::Button* _startAttackButton;  // 开始进攻按钮
@@ -366,6 +366,9 @@ void BasicScene::initTouchEventListeners() {
       // 结束拖动建筑
       if (isPlacementValid(_draggingBuilding)) {
         _draggingBuilding->_isDragging = false;
+        if (_buildingManager) {
+          _buildingManager->updateBuildingGrid(_draggingBuilding);
+        }
       } else {
         // 放置无效，返回原位置
         _draggingBuilding->setPosition(_buildingStartPos);
@@ -600,8 +603,9 @@ void BasicScene::onMouseUp(Event* event) {
           _draggingBuilding->setRow(startRow);
           _draggingBuilding->setCol(startCol);
         } else {
-          // 移动成功且有效，保存地图
+          // 移动成功且有效，重新登记占用的网格并保存地图
           if (_buildingManager) {
+            _buildingManager->updateBuildingGrid(_draggingBuilding);
             _buildingManager->saveBuildingMap();
           }
         }
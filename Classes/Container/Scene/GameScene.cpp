@@ -1046,32 +1046,8 @@ bool GameScene::checkBuildingOverlap(const Building* building) const {
     return false;
   }
 
-  const auto& buildings = _buildingManager->getAllBuildings();
-  float r1 = building->getRow();
-  float c1 = building->getCol();
-  int g1 = building->getGridCount();
-
-  for (const auto& other : buildings) {
-    if (other == building) {
-      continue;
-    }
-
-    float r2 = other->getRow();
-    float c2 = other->getCol();
-    int g2 = other->getGridCount();
-
-    // 检查两个正方形区域是否重叠
-    // 区域中心为 (r, c)，边长为 g
-    // 重叠条件：|r1 - r2| < (g1 + g2) / 2.0 && |c1 - c2| < (g1 + g2) / 2.0
-    // 注意：这里使用浮点数比较，且阈值必须严格小于
-    // 例如 2x2 和 2x2，阈值是 2。距离为 1 时重叠，距离为 2 时不重叠。
-    if (std::abs(r1 - r2) < (g1 + g2) / 2.0f &&
-        std::abs(c1 - c2) < (g1 + g2) / 2.0f) {
-      return true;
-    }
-  }
-
-  return false;
+  // 按建筑占用的网格查占用表，与建筑数量无关
+  return _buildingManager->isAreaOccupied(building);
 }
 
 bool GameScene::isPlacementValid(Building* building) const {
@@ -2,13 +2,11 @@
 
 #include <algorithm>
 #include <fstream>
+#include <map>
 #include <sstream>
+#include <utility>
 
 #include "Container/Scene/SenceHelper.h"
-#include "Game/Building/DefenseBuilding.h"
-#include "Game/Spell/HealSpell.h"
-#include "Game/Spell/LightningSpell.h"
-#include "Game/Spell/RageSpell.h"
 #include "Utils/PathUtils.h"
 #include "json/document.h"
 #include "platform/CCFileUtils.h"
@@ -43,20 +41,28 @@ bool RecordScene::init(const std::string& mapFilePath,
 
   // 初始化变量
   _records.clear();
-  _placedSoldiers.clear();
-  _activeSpells.clear();
   _isPlaying = false;
   _isPaused = false;
   _currentTime = 0.0f;
   _currentRecordIndex = 0;
   _totalDuration = 0;
-  _playbackSpeed = 1.0f;
   _playButton = nullptr;
   _pauseButton = nullptr;
   _stopButton = nullptr;
+  _speedButton = nullptr;
   _exitButton = nullptr;
   _timeLabel = nullptr;
 
+  // 创建并初始化 BattleManager（注册地图中的所有建筑）
+  _battleManager =
+      new (std::nothrow) BattleManager(_buildingManager, _mapLayer, _p00);
+  if (!_battleManager || !_battleManager->init()) {
+    CC_SAFE_DELETE(_battleManager);
+    return false;
+  }
+  // 按逻辑帧布置记录，回放结果与渲染帧率和回放速度无关
+  _battleManager->setTickCallback([this](int tick) { deployRecords(tick); });
+
   // 加载记录文件
   if (recordFilePath.empty()) {
     CCLOG("RecordScene: recordFilePath is empty, cannot load record");
@@ -67,6 +73,7 @@ bool RecordScene::init(const std::string& mapFilePath,
           recordFilePath.c_str());
     return false;
   }
+  prewarmSoldiers();
 
   // 创建回放控制按钮
   createPlaybackButtons();
@@ -154,6 +161,11 @@ bool RecordScene::loadRecordFile(const std::string& filePath) {
           record.timestamp = recordObj["timestamp"].GetInt();
         }
 
+        // 读取逻辑帧（旧记录没有该字段）
+        if (recordObj.HasMember("tick") && recordObj["tick"].IsInt()) {
+          record.tick = recordObj["tick"].GetInt();
+        }
+
         _records.push_back(record);
       }
     }
@@ -173,8 +185,8 @@ bool RecordScene::loadRecordFile(const std::string& filePath) {
     _totalDuration = _records.back().timestamp + 10;
   }
 
-  // 按时间戳排序
-  std::sort(_records.begin(), _records.end(),
+  // 按时间戳排序（同一秒内保持布置顺序）
+  std::stable_sort(_records.begin(), _records.end(),
             [](const PlacementRecord& a, const PlacementRecord& b) {
               return a.timestamp < b.timestamp;
             });
@@ -277,15 +289,15 @@ void RecordScene::createPlaybackButtons() {
     if (_isPlaying && !_isPaused) {
       _isPaused = true;
       this->unschedule("updatePlayback");
-      // 暂停时停止防御建筑攻击更新
-      this->unschedule("updateDefenseBuildings");
+      // 暂停时停止战斗更新
+      this->unschedule("updateBattle");
     } else if (_isPaused) {
       _isPaused = false;
       this->schedule([this](float dt) { this->updatePlayback(dt); }, 0.1f,
                      "updatePlayback");
-      // 恢复时重新启动防御建筑攻击更新
-      this->schedule([this](float dt) { this->updateDefenseBuildings(dt); },
-                     0.0f, "updateDefenseBuildings");
+      // 恢复时重新启动战斗更新
+      this->schedule([this](float dt) { this->updateBattle(dt); }, 0.0f,
+                     "updateBattle");
     }
   });
   this->addChild(_pauseButton, 200);
@@ -323,6 +335,29 @@ void RecordScene::createPlaybackButtons() {
            origin.y + visibleSize.height - margin - buttonHeight / 2));
   this->addChild(_timeLabel, 200);
 
+  // 创建倍速按钮（在时间标签右侧）
+  Vec2 speedButtonPos(
+      origin.x + margin + buttonWidth / 2 + (buttonWidth + buttonSpacing) * 4 +
+          100,
+      origin.y + visibleSize.height - margin - buttonHeight / 2);
+
+  // 创建橙色圆角背景
+  auto speedBgDrawNode =
+      createOrangeRoundedBackground(Size(buttonWidth, buttonHeight), radius);
+  speedBgDrawNode->setPosition(Vec2(speedButtonPos.x - buttonWidth / 2,
+                                    speedButtonPos.y - buttonHeight / 2));
+  this->addChild(speedBgDrawNode, 199);
+
+  _speedButton = ui::Button::create();
+  _speedButton->setTitleText("1x");
+  _speedButton->setTitleFontSize(20);
+  _speedButton->setTitleColor(Color3B::WHITE);
+  _speedButton->setContentSize(Size(buttonWidth, buttonHeight));
+  _speedButton->setPosition(speedButtonPos);
+  _speedButton->addClickEventListener(
+      [this](Ref* sender) { this->toggleSpeed(); });
+  this->addChild(_speedButton, 200);
+
   // 更新时间显示
   char buffer[32];
   snprintf(buffer, sizeof(buffer), "00:00 / %02d:%02d", _totalDuration / 60,
@@ -341,19 +376,9 @@ void RecordScene::startPlayback() {
   _currentRecordIndex = 0;
 
   // 清空之前的回放
-  for (auto soldier : _placedSoldiers) {
-    if (soldier) {
-      soldier->removeFromParent();
-    }
-  }
-  _placedSoldiers.clear();
-
-  for (auto spell : _activeSpells) {
-    if (spell) {
-      spell->removeFromParent();
-    }
+  if (_battleManager) {
+    _battleManager->clearUnits(true);
   }
-  _activeSpells.clear();
 
   // 更新按钮状态
   if (_playButton) {
@@ -372,8 +397,8 @@ void RecordScene::startPlayback() {
   // 启动回放更新
   this->schedule([this](float dt) { this->updatePlayback(dt); }, 0.1f,
                  "updatePlayback");
-  this->schedule([this](float dt) { this->updateDefenseBuildings(dt); }, 0.0f,
-                 "updateDefenseBuildings");
+  this->schedule([this](float dt) { this->updateBattle(dt); }, 0.0f,
+                 "updateBattle");
 
   CCLOG("RecordScene: Playback started");
 }
@@ -386,8 +411,8 @@ void RecordScene::stopPlayback() {
   // 停止回放更新
   this->unschedule("updatePlayback");
 
-  // 停止防御建筑攻击更新
-  this->unschedule("updateDefenseBuildings");
+  // 停止战斗更新
+  this->unschedule("updateBattle");
 
   // 重置状态
   _isPlaying = false;
@@ -396,19 +421,9 @@ void RecordScene::stopPlayback() {
   _currentRecordIndex = 0;
 
   // 清空回放内容
-  for (auto soldier : _placedSoldiers) {
-    if (soldier) {
-      soldier->removeFromParent();
-    }
-  }
-  _placedSoldiers.clear();
-
-  for (auto spell : _activeSpells) {
-    if (spell) {
-      spell->removeFromParent();
-    }
+  if (_battleManager) {
+    _battleManager->clearUnits(true);
   }
-  _activeSpells.clear();
 
   // 更新按钮状态
   if (_playButton) {
@@ -440,24 +455,8 @@ void RecordScene::updatePlayback(float dt) {
     return;
   }
 
-  // 更新当前时间
-  _currentTime += dt * _playbackSpeed;
-
-  // 检查并执行需要播放的记录
-  while (_currentRecordIndex < _records.size()) {
-    const PlacementRecord& record = _records[_currentRecordIndex];
-    if (record.timestamp <= static_cast<int>(_currentTime)) {
-      // 执行记录
-      if (record.type == "troop") {
-        createSoldierFromRecord(record);
-      } else if (record.type == "spell") {
-        createSpellFromRecord(record);
-      }
-      _currentRecordIndex++;
-    } else {
-      break;
-    }
-  }
+  // 回放时间由战斗时钟推进
+  _currentTime = _battleManager ? _battleManager->getBattleTime() : 0.0f;
 
   // 更新时间显示
   if (_timeLabel) {
@@ -477,202 +476,123 @@ void RecordScene::updatePlayback(float dt) {
   }
 }
 
-void RecordScene::createSoldierFromRecord(const PlacementRecord& record) {
-  // 转换士兵类型字符串为枚举
-  SoldierType soldierType = SoldierType::BARBARIAN;
-  if (record.category == "barbarian") {
-    soldierType = SoldierType::BARBARIAN;
-  } else if (record.category == "archer") {
-    soldierType = SoldierType::ARCHER;
-  } else if (record.category == "giant") {
-    soldierType = SoldierType::GIANT;
-  } else if (record.category == "bomber") {
-    soldierType = SoldierType::BOMBER;
+void RecordScene::prewarmSoldiers() {
+  // 按记录中每个兵种和等级的部署数量预先创建士兵精灵
+  std::map<std::pair<SoldierType, int>, int> counts;
+  for (const PlacementRecord& record : _records) {
+    SoldierType soldierType = SoldierType::BARBARIAN;
+    if (record.type == "troop" &&
+        BattleTypeUtils::parseSoldierType(record.category, soldierType)) {
+      counts[std::make_pair(soldierType, record.level)]++;
+    }
   }
-
-  // 创建士兵
-  auto soldier = BasicSoldier::create(soldierType, record.level);
-  if (soldier) {
-    soldier->setPosition(Vec2(record.x, record.y));
-    _mapLayer->addChild(soldier, 5);
-    _placedSoldiers.push_back(soldier);
-
-    // 设置建筑查找回调
-    soldier->setBuildingFinderCallback([this]() {
-      std::vector<Building*> buildings;
-      if (_buildingManager) {
-        const auto& allBuildings = _buildingManager->getAllBuildings();
-        // 只返回存活的建筑
-        for (Building* building : allBuildings) {
-          if (building && building->isVisible() && building->isAlive()) {
-            buildings.push_back(building);
-          }
-        }
-      }
-      return buildings;
-    });
-
-    // [修复] 设置网格状态回调，确保寻路算法能正确感知障碍物
-    soldier->setGridStatusCallback([this](int row, int col) -> bool {
-      // 检查是否越界
-      if (row < 0 || row >= _gridSize || col < 0 || col >= _gridSize) {
-        return false;
-      }
-      // 检查是否有建筑占据
-      if (_buildingManager) {
-        Building* building = _buildingManager->getBuildingAtGrid(row, col);
-        if (building && building->isAlive()) {
-          // 建筑占据不可通行（除非是城墙且攻击者是炸弹人，这部分逻辑在BasicSoldier内部处理）
-          return false;
-        }
-      }
-      return true;  // 默认可通行
-    });
-
-    // [修复] 设置原点坐标，用于坐标转换
-    soldier->setP00(_p00);
-
-    CCLOG("RecordScene: Created soldier %s Lv%d at (%.1f, %.1f) @ %ds",
-          record.category.c_str(), record.level, record.x, record.y,
-          record.timestamp);
+  for (const auto& entry : counts) {
+    _battleManager->prewarmSoldiers(entry.first.first, entry.first.second,
+                                    entry.second);
   }
 }
 
-void RecordScene::createSpellFromRecord(const PlacementRecord& record) {
-  // 转换法术类型字符串为枚举
-  SpellType spellType = SpellType::HEAL;
-  if (record.category == "Heal") {
-    spellType = SpellType::HEAL;
-  } else if (record.category == "Lightning") {
-    spellType = SpellType::LIGHTNING;
-  } else if (record.category == "Rage") {
-    spellType = SpellType::RAGE;
-  }
-
-  // 创建法术
-  BasicSpell* spell = nullptr;
-  switch (spellType) {
-    case SpellType::HEAL:
-      spell = HealSpell::create();
-      break;
-    case SpellType::LIGHTNING:
-      spell = LightningSpell::create();
-      break;
-    case SpellType::RAGE:
-      spell = RageSpell::create();
+void RecordScene::deployRecords(int tick) {
+  // 检查并执行需要播放的记录
+  while (_currentRecordIndex < _records.size()) {
+    const PlacementRecord& record = _records[_currentRecordIndex];
+    if (getRecordTick(record) > tick) {
       break;
-  }
-
-  if (spell) {
-    // 设置目标查找回调
-    spell->setSoldierFinderCallback([this]() { return _placedSoldiers; });
-    spell->setBuildingFinderCallback([this]() {
-      // 从 BuildingManager 获取建筑列表
-      std::vector<Building*> buildings;
-      if (_buildingManager) {
-        const auto& allBuildings = _buildingManager->getAllBuildings();
-        // 只返回存活的建筑
-        for (Building* building : allBuildings) {
-          if (building && building->isVisible() && building->isAlive()) {
-            buildings.push_back(building);
-          }
-        }
-      }
-      return buildings;
-    });
-
-    // 获取所有建筑（用于cast方法）
-    std::vector<Building*> buildings;
-    if (_buildingManager) {
-      const auto& allBuildings = _buildingManager->getAllBuildings();
-      // 只返回存活的建筑
-      for (Building* building : allBuildings) {
-        if (building && building->isVisible() && building->isAlive()) {
-          buildings.push_back(building);
-        }
-      }
     }
 
-    // 施放法术
-    if (spell->cast(Vec2(record.x, record.y), _placedSoldiers, buildings)) {
-      _mapLayer->addChild(spell, 8);
-      _activeSpells.push_back(spell);
-
-      CCLOG("RecordScene: Created spell %s at (%.1f, %.1f) @ %ds",
-            record.category.c_str(), record.x, record.y, record.timestamp);
-    } else {
-      CC_SAFE_DELETE(spell);
+    // 执行记录
+    if (record.type == "troop") {
+      createSoldierFromRecord(record);
+    } else if (record.type == "spell") {
+      createSpellFromRecord(record);
     }
+    _currentRecordIndex++;
   }
 }
 
-void RecordScene::updateDefenseBuildings(float delta) {
-  // 如果回放未开始或已暂停，不更新防御建筑
-  if (!_isPlaying || _isPaused) {
-    return;
+int RecordScene::getRecordTick(const PlacementRecord& record) const {
+  if (record.tick >= 0) {
+    return record.tick;
   }
+  int tickRate = _battleManager ? _battleManager->getTickRate()
+                                : BattleClock::DEFAULT_TICK_RATE;
+  return record.timestamp * tickRate;
+}
 
-  // 如果没有建筑管理器或没有士兵，直接返回
-  if (!_buildingManager || _placedSoldiers.empty()) {
+void RecordScene::toggleSpeed() {
+  if (!_battleManager) {
     return;
   }
 
-  // 获取所有建筑
-  const auto& allBuildings = _buildingManager->getAllBuildings();
+  int speed = _battleManager->getSpeed() * 2;
+  if (speed > 8) {
+    speed = 1;
+  }
+  _battleManager->setSpeed(speed);
 
-  // 遍历所有建筑，找到防御建筑并更新攻击
-  for (Building* building : allBuildings) {
-    if (!building || !building->isVisible() || !building->isAlive()) {
-      continue;
-    }
+  if (_speedButton) {
+    _speedButton->setTitleText(std::to_string(speed) + "x");
+  }
+}
 
-    // 检查是否为防御建筑
-    if (building->getBuildingType() != BuildingType::DEFENSE) {
-      continue;
-    }
+void RecordScene::createSoldierFromRecord(const PlacementRecord& record) {
+  if (!_battleManager) {
+    return;
+  }
 
-    // 转换为防御建筑
-    DefenseBuilding* defenseBuilding = dynamic_cast<DefenseBuilding*>(building);
-    if (!defenseBuilding) {
-      continue;
-    }
+  // 转换士兵类型字符串为枚举
+  SoldierType soldierType = SoldierType::BARBARIAN;
+  BattleTypeUtils::parseSoldierType(record.category, soldierType);
+
+  // 创建士兵
+  auto soldier = _battleManager->deploySoldier(soldierType, record.level,
+                                               Vec2(record.x, record.y));
+  if (soldier) {
+    CCLOG("RecordScene: Created soldier %s Lv%d at (%.1f, %.1f) @ %ds",
+          record.category.c_str(), record.level, record.x, record.y,
+          record.timestamp);
+  }
+}
+
+void RecordScene::createSpellFromRecord(const PlacementRecord& record) {
+  if (!_battleManager) {
+    return;
+  }
 
-    // 根据建筑名称决定攻击类别
-    // 默认攻击所有类别，可以根据需要扩展
-    std::vector<SoldierCategory> targetCategories = {SoldierCategory::LAND,
-                                                     SoldierCategory::AIR};
+  // 转换法术类型字符串为枚举
+  SpellType spellType = SpellType::HEAL;
+  BattleTypeUtils::parseSpellType(record.category, spellType);
 
-    // 可以根据建筑名称设置不同的攻击类别
-    // 例如：防空火箭只攻击空军，加农炮只攻击陆军等
-    // 这里先实现攻击所有类别，后续可以根据配置扩展
-    // 如果 targetCategories 为空，attackSoldiers 会攻击所有类别
+  // 施放法术
+  auto spell =
+      _battleManager->castSpell(spellType, Vec2(record.x, record.y));
+  if (spell) {
+    CCLOG("RecordScene: Created spell %s at (%.1f, %.1f) @ %ds",
+          record.category.c_str(), record.x, record.y, record.timestamp);
+  }
+}
 
-    // 调用防御建筑的攻击方法
-    defenseBuilding->attackSoldiers(_placedSoldiers, targetCategories, delta);
+void RecordScene::updateBattle(float delta) {
+  // 如果回放未开始或已暂停，不推进战斗
+  if (!_isPlaying || _isPaused || !_battleManager) {
+    return;
   }
+
+  _battleManager->update(delta);
 }
 
 RecordScene::~RecordScene() {
   // 停止回放
   if (_isPlaying) {
     this->unschedule("updatePlayback");
-    this->unschedule("updateDefenseBuildings");
+    this->unschedule("updateBattle");
   }
 
   // 清理士兵和法术
-  for (auto soldier : _placedSoldiers) {
-    if (soldier) {
-      soldier->removeFromParent();
-    }
-  }
-  _placedSoldiers.clear();
-
-  for (auto spell : _activeSpells) {
-    if (spell) {
-      spell->removeFromParent();
-    }
+  if (_battleManager) {
+    _battleManager->clearUnits(true);
   }
-  _activeSpells.clear();
+  CC_SAFE_DELETE(_battleManager);
 }
 
 void RecordScene::onMouseDown(Event* event) {
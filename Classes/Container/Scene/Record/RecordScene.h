@@ -5,9 +5,7 @@
 #include <vector>
 
 #include "Container/Scene/Basic/BasicScene.h"
-#include "Game/Building/DefenseBuilding.h"
-#include "Game/Soldier/BasicSoldier.h"
-#include "Game/Spell/BasicSpell.h"
+#include "Manager/Battle/BattleManager.h"
 #include "Manager/Record/RecordManager.h"
 #include "ui/CocosGUI.h"
 
@@ -43,10 +41,31 @@ class RecordScene : public BasicScene {
   void stopPlayback();
 
   /**
-   * 回放更新函数
+   * 回放更新函数（刷新时间显示并检查是否播放完成）
    */
   void updatePlayback(float dt);
 
+  /**
+   * 布置到达指定逻辑帧的记录（由战斗时钟在每个逻辑帧之前调用）
+   * @param tick 已完成的逻辑帧数
+   */
+  void deployRecords(int tick);
+
+  /**
+   * 按记录中的部署数量预先创建士兵精灵
+   */
+  void prewarmSoldiers();
+
+  /**
+   * 获取记录对应的逻辑帧（旧记录没有逻辑帧，按时间戳换算）
+   */
+  int getRecordTick(const PlacementRecord& record) const;
+
+  /**
+   * 切换回放速度（1x -> 2x -> 4x -> 8x -> 1x）
+   */
+  void toggleSpeed();
+
   /**
    * 根据记录创建士兵
    */
@@ -63,10 +82,11 @@ class RecordScene : public BasicScene {
   void createPlaybackButtons();
 
   /**
-   * 更新防御建筑攻击（每帧调用）
+   * 推进战斗（每帧调用）
+   * 由 BattleManager 结算士兵、法术、防御建筑和陷阱
    * @param delta 时间间隔
    */
-  void updateDefenseBuildings(float delta);
+  void updateBattle(float delta);
 
   /**
    * 重写鼠标按下事件，禁用建筑拖动（只允许地图拖动）
@@ -88,22 +108,21 @@ class RecordScene : public BasicScene {
    */
   void exitScene();
 
-  std::vector<PlacementRecord> _records;       // 记录列表
-  std::vector<BasicSoldier*> _placedSoldiers;  // 已布置的士兵列表
-  std::vector<BasicSpell*> _activeSpells;      // 活跃的法术列表
-  int _totalDuration;                          // 总时长（秒）
+  std::vector<PlacementRecord> _records;     // 记录列表
+  BattleManager* _battleManager = nullptr;  // 战斗管理器实例
+  int _totalDuration;                        // 总时长（秒）
 
   // 回放控制相关
   cocos2d::ui::Button* _playButton;   // 播放按钮
   cocos2d::ui::Button* _pauseButton;  // 暂停按钮
   cocos2d::ui::Button* _stopButton;   // 停止按钮
+  cocos2d::ui::Button* _speedButton;  // 倍速按钮
   cocos2d::ui::Button* _exitButton;   // 退出按钮
   Label* _timeLabel;                  // 时间标签
   bool _isPlaying;                    // 是否正在播放
   bool _isPaused;                     // 是否暂停
   float _currentTime;                 // 当前回放时间（秒）
   size_t _currentRecordIndex;         // 当前记录索引
-  float _playbackSpeed;               // 回放速度倍数
 };
 
 #endif  // __RECORD_SCENE_H__
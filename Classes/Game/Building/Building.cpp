@@ -665,3 +665,11 @@ Building& Building::operator-=(float damage) {
 }
 
 bool Building::isAlive() const { return _currentHP > 0; }
+
+BattleBuildingStats Building::getBattleStats() const {
+  BattleBuildingStats stats;
+  stats.type = _buildingType;
+  stats.gridCount = _gridCount;
+  stats.maxHP = _maxHP;
+  return stats;
+}
@@ -3,23 +3,11 @@
 
 #include <functional>
 
+#include "Battle/BattleEntities.h"
 #include "cocos2d.h"
 
 USING_NS_CC;
 
-/**
- * 建筑类型枚举
- */
-enum class BuildingType {
-  TOWN_HALL,  // 大本营
-  DEFENSE,    // 防御建筑
-  RESOURCE,   // 资源建筑
-  STORAGE,    // 储存建筑
-  BARRACKS,   // 兵营
-  WALL,       // 城墙
-  TRAP        // 陷阱
-};
-
 /**
  * 建筑基础类
  * 所有建筑的基类，提供通用的建筑功能
@@ -119,6 +107,12 @@ class Building : public Sprite {
   bool isAlive() const;
   Building& operator-=(float damage);
 
+  /**
+   * 获取战斗核心使用的建筑属性
+   * 子类（防御建筑、陷阱）重写以补充攻击相关属性
+   */
+  virtual BattleBuildingStats getBattleStats() const;
+
  protected:
   Building();
   virtual ~Building();
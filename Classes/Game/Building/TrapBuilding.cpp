@@ -1,6 +1,6 @@
 #include "TrapBuilding.h"
 #include "Manager/Config/ConfigManager.h"
-#include <cmath>
+#include "Utils/GridUtils.h"
 
 TrapBuilding::TrapBuilding() 
     : _triggerRange(0.0f)
@@ -34,20 +34,9 @@ bool TrapBuilding::init(int level, const std::string& buildingName) {
 
     _buildingName = buildingName;
     _damage = config.damage;           // 读取配置中的伤害
-    // 将配置中的 Grid 单位范围转换为 Pixel 单位范围
-    // 获取网格的像素参数 (deltaX, deltaY)
-    auto constant = configManager->getConstantConfig();
-    
-    // 计算 1 个网格边长对应的屏幕像素距离 (勾股定理)
-    // 假设 deltaX 和 deltaY 是菱形网格半宽/半高，或者投影向量
-    // 这里估算一个网格的标准像素长度
-    float oneGridPixels = 50.0f; // 默认安全值
-    if (constant.deltaX > 0) {
-        oneGridPixels = std::sqrt(std::pow(constant.deltaX, 2) + std::pow(constant.deltaY, 2));
-    }
-
-    // attackRange 是网格数 (如 3.0)，转换为像素距离
-    _triggerRange = config.attackRange * oneGridPixels * 0.6f;
+    // 将配置中的 Grid 单位范围 (如 3.0) 按战斗核心的规则转换为 Pixel 单位范围
+    _triggerRange = static_cast<float>(
+        GridUtils::getProjection(Vec2::ZERO).rangeToPixels(config.attackRange));
     
     CCLOG("Trap Init: %s, GridRange: %.1f, PixelRange: %.1f", buildingName.c_str(), config.attackRange, _triggerRange);
 
@@ -78,13 +67,8 @@ void TrapBuilding::upgrade() {
     auto configManager = ConfigManager::getInstance();
     auto config = configManager->getBuildingConfig(_buildingName, _level);
     _damage = config.damage;
-
-    auto constant = configManager->getConstantConfig();
-    float oneGridPixels = 50.0f;
-    if (constant.deltaX > 0) {
-        oneGridPixels = std::sqrt(std::pow(constant.deltaX, 2) + std::pow(constant.deltaY, 2));
-    }
-    _triggerRange = config.attackRange * oneGridPixels * 0.6f;
+    _triggerRange = static_cast<float>(
+        GridUtils::getProjection(Vec2::ZERO).rangeToPixels(config.attackRange));
     
     // 升级后自动重置
     rearm();
@@ -99,32 +83,17 @@ void TrapBuilding::reveal() {
     this->setOpacity(255);
 }
 
-bool TrapBuilding::checkTrigger(const std::vector<BasicSoldier*>& soldiers) {
-    if (!_isArmed) return false;
-
-    // 遍历敌人，检查是否有进入触发范围的
-    bool triggered = false;
-    
-    // 这里的坐标计算需要根据实际场景坐标系调整
-    Vec2 myPos = this->getPosition(); 
-    
-    for (const auto& soldier : soldiers) {
-        if (soldier && soldier->isAlive() && soldier->getPosition().distance(myPos) <= _triggerRange) {
-            triggered = true;
-            break;
-        }
-    }
-
-    if (triggered) {
-        explode(soldiers);
-        return true;
-    }
-
-    return false;
+BattleBuildingStats TrapBuilding::getBattleStats() const {
+    BattleBuildingStats stats = Building::getBattleStats();
+    stats.damage = _damage;
+    // 触发范围以网格数传给战斗核心，由其换算为像素距离
+    auto config = ConfigManager::getInstance()->getBuildingConfig(_buildingName, _level);
+    stats.attackRange = config.attackRange;
+    return stats;
 }
 
-void TrapBuilding::explode(const std::vector<BasicSoldier*>& soldiers) {
-    _isArmed = false; // 标记为已触发，防止重复爆炸
+void TrapBuilding::playExplosionEffect() {
+    _isArmed = false; // 标记为已触发
 
     // 1. 显形
     reveal();
@@ -147,24 +116,8 @@ void TrapBuilding::explode(const std::vector<BasicSoldier*>& soldiers) {
             this->addChild(particle, 100);
         }
     }
-    
-    // 3. 造成区域伤害
-    // 爆炸范围通常等于或略大于触发范围
-    float damageRadius = _triggerRange * 1.5f; 
-    Vec2 myPos = this->getPosition();
-
-    // 现在可以直接使用 soldiers 变量了
-    for (const auto& soldier : soldiers) {
-        // 增加存活检查
-        if (soldier && soldier->isAlive()) {
-            float distance = soldier->getPosition().distance(myPos);
-            if (distance <= damageRadius) {
-                soldier->takeDamage(_damage);
-            }
-        }
-    }
 
-    // 4. 延迟1秒后消失
+    // 3. 延迟1秒后消失
     auto delay = DelayTime::create(1.0f);
     auto hide = Hide::create();
     auto seq = Sequence::create(delay, hide, nullptr);
@@ -2,8 +2,6 @@
 #define __TRAP_BUILDING_H__
 
 #include "Building.h"
-#include "Game/Soldier/BasicSoldier.h"
-#include <vector>
 
 /**
  * 陷阱建筑类
@@ -26,11 +24,14 @@ public:
     CC_SYNTHESIZE(bool, _isArmed, IsArmed);            // 是否已布防
 
     /**
-     * 检查并尝试触发陷阱
-     * @param soldiers 附近的敌军列表
-     * @return 是否成功触发
+     * 获取战斗核心使用的建筑属性（伤害与触发范围，触发判定由 BattleWorld 负责）
      */
-    bool checkTrigger(const std::vector<BasicSoldier*>& soldiers);
+    virtual BattleBuildingStats getBattleStats() const override;
+
+    /**
+     * 播放爆炸表现：显形、粒子特效，1秒后隐藏
+     */
+    void playExplosionEffect();
 
     /**
      * 显示陷阱（用于触发时或自己查看时）
@@ -50,11 +51,6 @@ public:
 protected:
     TrapBuilding();
     virtual ~TrapBuilding();
-
-    /**
-     * 执行爆炸逻辑：造成伤害、播放特效、移除自身状态
-     */
-    void explode(const std::vector<BasicSoldier*>& soldiers);
 };
 
 #endif // __TRAP_BUILDING_H__
\ No newline at end of file
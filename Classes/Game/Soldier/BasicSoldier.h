@@ -1,55 +1,15 @@
 #ifndef __BASIC_SOILDER_H__
 #define __BASIC_SOILDER_H__
 
-#include <functional>
-#include <vector>
-
-#include "Game/Building/Building.h"
+#include "Battle/BattleEntities.h"
 #include "cocos2d.h"
 
 USING_NS_CC;
 
-/**
- * 士兵状态枚举
- */
-enum class SoldierState {
-  IDLE,       // 待机
-  MOVING,     // 移动中
-  ATTACKING,  // 攻击中
-  DEAD        // 死亡
-};
-/**
- * 士兵分类枚举
- */
-enum class SoldierCategory {
-  LAND,  // 陆军
-  AIR,   // 空军
-};
-/**
- * 士兵类型枚举
- */
-enum class SoldierType {
-  BARBARIAN,  // 野蛮人
-  ARCHER,     // 弓箭手
-  GIANT,      // 巨人
-  BOMBER,      // 炸弹人
-  DRAGON      // 飞龙
-};
-// TODO 大本营删除
-/**
- * 攻击类型枚举
- */
-enum class AttackType {
-  ANY,        // 任意目标
-  DEFENSE,    // 优先防御建筑
-  RESOURCE,   // 优先资源建筑
-  TOWN_HALL,  // 优先大本营
-  WALL        // 优先墙
-};
-
 /**
  * 士兵基础类
- * 所有士兵的基类，提供通用的士兵功能
+ * 所有士兵的基类，负责士兵的外观和血条显示；
+ * 战斗逻辑由无头战斗核心 BattleWorld 推进，通过 syncFromBattle 同步
  */
 class BasicSoldier : public Sprite {
  public:
@@ -69,12 +29,6 @@ class BasicSoldier : public Sprite {
    */
   bool init(SoldierType soldierType, int level);
 
-  /**
-   * 更新函数（每帧调用）
-   * @param delta 时间间隔
-   */
-  virtual void update(float delta) override;
-
   // 属性访问器
   CC_SYNTHESIZE(SoldierType, _soldierType, SoldierType);
   CC_SYNTHESIZE(int, _level, Level);
@@ -90,24 +44,20 @@ class BasicSoldier : public Sprite {
   CC_SYNTHESIZE(float, _centerX, CenterX);
   CC_SYNTHESIZE(float, _centerY, CenterY);
 
-  // 寻路相关
-  std::vector<Vec2> _pathQueue;
-  int _currentPathIndex;
-  std::function<bool(int, int)> _gridStatusCallback;
-
-  CC_SYNTHESIZE(Building*, _target, Target);
-  CC_SYNTHESIZE(Vec2, _p00, P00);  // 地图原点
-
   /**
-   * 设置网格状态回调
+   * 获取战斗核心使用的士兵属性
+   * @return 士兵属性
    */
-  void setGridStatusCallback(std::function<bool(int, int)> callback);
+  BattleSoldierStats getBattleStats() const;
 
   /**
-   * 受到伤害
-   * @param damage 伤害值
+   * 根据战斗核心中的士兵数据更新位置、生命值和状态
+   * @param soldiers 战斗核心中的士兵数组
+   * @param index 士兵 id
+   * @param renderPosition 插值后的渲染位置（地图层坐标）
    */
-  void takeDamage(float damage);
+  void syncFromBattle(const BattleSoldierArray& soldiers, int index,
+                      const Vec2& renderPosition);
 
   /**
    * 是否存活
@@ -116,45 +66,9 @@ class BasicSoldier : public Sprite {
   bool isAlive() const;
 
   /**
-   * 设置目标位置（用于移动）
-   * @param position 目标位置
-   */
-  void setTargetPosition(const Vec2& position);
-
-  /**
-   * 寻找目标
-   * @param buildings 建筑列表
-   * @return 是否找到目标
+   * 恢复满血和初始属性并重新显示，用于从对象池中取出后再次部署
    */
-  bool findTarget(const std::vector<Building*>& buildings);
-
-  /**
-   * 设置建筑查找回调函数
-   * @param callback 返回建筑列表的回调函数
-   */
-  void setBuildingFinderCallback(
-      std::function<std::vector<Building*>()> callback);
-
-  /**
-   * 检查目标是否在攻击范围内
-   * @param targetPos 目标位置
-   * @return 是否在范围内
-   */
-  bool isInRange(const Vec2& targetPos) const;
-
-  /**
-   * 检查建筑是否在攻击范围内（考虑建筑体积）
-   * @param target 目标建筑
-   * @return 是否在范围内
-   */
-  bool isInRange(Building* target) const;
-
-  /**
-   * 计算到目标位置的距离
-   * @param pos 目标位置
-   * @return 距离
-   */
-  float getDistanceTo(const Vec2& pos) const;
+  void resetForDeploy();
 
   /**
    * 更新生命值条显示
@@ -170,36 +84,16 @@ class BasicSoldier : public Sprite {
    */
   virtual void createDefaultAppearance();
 
-  /**
-   * 更新状态机
-   * @param delta 时间间隔
-   */
-  void updateState(float delta);
-
-  /**
-   * 移动到目标位置
-   * @param delta 时间间隔
-   */
-  void moveToTarget(float delta);
-
-  /**
-   * 攻击目标
-   * @param delta 时间间隔
-   */
-  virtual void attackTarget(float delta);
-
   /**
    * 死亡处理
    */
   void die();
 
-  Vec2 _targetPosition;        // 目标位置（用于移动）
-  float _attackCooldown;       // 攻击冷却时间
+  BattleSoldierStats _baseStats;  // 配置中的初始属性
+
   DrawNode* _hpBarBackground;  // 生命值条背景
   DrawNode* _hpBarForeground;  // 生命值条前景
   Label* _infoLabel;           // 信息显示标签
-  std::function<std::vector<Building*>()>
-      _buildingFinderCallback;  // 建筑查找回调函数
 };
 
 #endif  // __BASIC_SOILDER_H__
@@ -0,0 +1,63 @@
+#include "SoldierPool.h"
+
+SoldierPool::SoldierPool() {}
+
+SoldierPool::~SoldierPool() { clear(); }
+
+void SoldierPool::prewarm(SoldierType soldierType, int level, int count) {
+  std::vector<BasicSoldier*>& soldiers = _free[Key(soldierType, level)];
+  soldiers.reserve(count);
+  while (static_cast<int>(soldiers.size()) < count) {
+    BasicSoldier* soldier = BasicSoldier::create(soldierType, level);
+    if (!soldier) {
+      CCLOG("SoldierPool::prewarm: Failed to create soldier type %d Lv%d",
+            static_cast<int>(soldierType), level);
+      return;
+    }
+    soldier->retain();
+    soldiers.push_back(soldier);
+  }
+}
+
+BasicSoldier* SoldierPool::acquire(SoldierType soldierType, int level) {
+  BasicSoldier* soldier = nullptr;
+  auto it = _free.find(Key(soldierType, level));
+  if (it != _free.end() && !it->second.empty()) {
+    // 交还池持有的引用，由调用方加入场景后持有
+    soldier = it->second.back();
+    it->second.pop_back();
+    soldier->autorelease();
+  } else {
+    soldier = BasicSoldier::create(soldierType, level);
+    if (!soldier) {
+      return nullptr;
+    }
+  }
+
+  soldier->resetForDeploy();
+  return soldier;
+}
+
+void SoldierPool::release(BasicSoldier* soldier) {
+  if (!soldier) {
+    return;
+  }
+  soldier->retain();
+  soldier->removeFromParent();
+  _free[Key(soldier->getSoldierType(), soldier->getLevel())].push_back(
+      soldier);
+}
+
+void SoldierPool::clear() {
+  for (auto& entry : _free) {
+    for (BasicSoldier* soldier : entry.second) {
+      soldier->release();
+    }
+  }
+  _free.clear();
+}
+
+int SoldierPool::getAvailableCount(SoldierType soldierType, int level) const {
+  auto it = _free.find(Key(soldierType, level));
+  return it != _free.end() ? static_cast<int>(it->second.size()) : 0;
+}
@@ -0,0 +1,56 @@
+#ifndef __SOLDIER_POOL_H__
+#define __SOLDIER_POOL_H__
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "Game/Soldier/BasicSoldier.h"
+#include "cocos2d.h"
+
+USING_NS_CC;
+
+/**
+ * 士兵精灵对象池
+ * 按兵种和等级缓存士兵精灵。创建士兵需要加载图片、创建血条和标签，
+ * 集中在场景初始化时预先创建，部署时只需重置状态后取出；
+ * 死亡或回放重置时归还到池中再次使用
+ */
+class SoldierPool {
+ public:
+  SoldierPool();
+  ~SoldierPool();
+
+  /**
+   * 预先创建士兵，使池中至少有 count 个指定兵种和等级的士兵
+   */
+  void prewarm(SoldierType soldierType, int level, int count);
+
+  /**
+   * 取出一个士兵并重置为满血（池中没有时新建）
+   * @return 士兵精灵（autorelease），失败返回nullptr
+   */
+  BasicSoldier* acquire(SoldierType soldierType, int level);
+
+  /**
+   * 将士兵从父节点移除并归还到池中
+   */
+  void release(BasicSoldier* soldier);
+
+  /**
+   * 释放池中缓存的所有士兵
+   */
+  void clear();
+
+  /**
+   * 池中可用的指定兵种和等级的士兵数量
+   */
+  int getAvailableCount(SoldierType soldierType, int level) const;
+
+ private:
+  using Key = std::pair<SoldierType, int>;
+
+  std::map<Key, std::vector<BasicSoldier*>> _free;  // 已 retain 的空闲士兵
+};
+
+#endif  // __SOLDIER_POOL_H__
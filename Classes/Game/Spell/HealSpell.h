@@ -24,23 +24,6 @@ class HealSpell : public BasicSpell {
   bool init() override;
 
  protected:
-  /**
-   * 应用治疗效果
-   * @param soldiers 范围内的士兵列表
-   * @param buildings 范围内的建筑列表（治疗法术不影响建筑）
-   */
-  void applyEffect(const std::vector<BasicSoldier*>& soldiers,
-                   const std::vector<Building*>& buildings) override;
-
-  /**
-   * 更新持续治疗效果
-   * @param delta 时间间隔
-   * @param soldiers 范围内的士兵列表
-   * @param buildings 范围内的建筑列表
-   */
-  void updateEffect(float delta, const std::vector<BasicSoldier*>& soldiers,
-                    const std::vector<Building*>& buildings) override;
-
   /**
    * 创建视觉效果（绿色治疗圈）
    */
@@ -48,9 +31,6 @@ class HealSpell : public BasicSpell {
 
   HealSpell();
   virtual ~HealSpell();
-
- private:
-  float _healPerSecond;  // 每秒治疗量
 };
 
 #endif  // __HEAL_SPELL_H__
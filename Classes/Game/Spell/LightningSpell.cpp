@@ -3,8 +3,6 @@
 #include <cmath>
 #include <cstdlib>
 
-#include "Game/Building/Building.h"
-#include "Game/Soldier/BasicSoldier.h"
 #include "Utils/AudioManager.h"
 
 LightningSpell::LightningSpell() { _spellType = SpellType::LIGHTNING; }
@@ -29,25 +27,11 @@ bool LightningSpell::init() {
   return true;
 }
 
-void LightningSpell::applyEffect(const std::vector<BasicSoldier*>& soldiers,
-                                 const std::vector<Building*>& buildings) {
-  // 对范围内的建筑造成伤害
-  for (Building* building : buildings) {
-    if (building && building->isVisible() && building->isAlive()) {
-      building->takeDamage(_amount);
-      CCLOG(
-          "LightningSpell: Dealt %.1f damage to building, building HP: "
-          "%.1f/%.1f",
-          _amount, building->getCurrentHP(), building->getMaxHP());
-    }
-  }
-
+void LightningSpell::createVisualEffect() {
   // 播放闪电法术音效（一次）
   AudioManager::getInstance()->playEffect(
       "ringtones/bottle_break_04_lightning_01.mp3");
-}
 
-void LightningSpell::createVisualEffect() {
   // 创建闪电效果
   auto drawNode = DrawNode::create();
 
@@ -24,14 +24,6 @@ class LightningSpell : public BasicSpell {
   bool init() override;
 
  protected:
-  /**
-   * 应用雷电伤害效果
-   * @param soldiers 范围内的士兵列表
-   * @param buildings 范围内的建筑列表
-   */
-  void applyEffect(const std::vector<BasicSoldier*>& soldiers,
-                   const std::vector<Building*>& buildings) override;
-
   /**
    * 创建视觉效果（闪电效果）
    */
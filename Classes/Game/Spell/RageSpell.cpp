@@ -1,13 +1,8 @@
 #include "RageSpell.h"
 
-#include "Game/Soldier/BasicSoldier.h"
-
 RageSpell::RageSpell() { _spellType = SpellType::RAGE; }
 
-RageSpell::~RageSpell() {
-  // 确保在析构时恢复所有士兵的速度
-  onSpellEnd();
-}
+RageSpell::~RageSpell() {}
 
 RageSpell* RageSpell::create() {
   RageSpell* spell = new (std::nothrow) RageSpell();
@@ -37,89 +32,6 @@ bool RageSpell::init() {
   return true;
 }
 
-void RageSpell::applyEffect(const std::vector<BasicSoldier*>& soldiers,
-                            const std::vector<Building*>& buildings) {
-  // 提升范围内士兵的移动速度、攻击速度和攻击力
-  for (BasicSoldier* soldier : soldiers) {
-    if (soldier && soldier->isAlive()) {
-      // 检查是否已经受到狂暴效果影响
-      if (_affectedSoldiers.find(soldier) == _affectedSoldiers.end()) {
-        // 使用乘法提升属性（_ratio如1.5表示提升50%，即乘以1.5）
-        float currentMoveSpeed = soldier->getMoveSpeed();
-        float currentAttackSpeed = soldier->getAttackSpeed();
-        float currentAttackDamage = soldier->getAttackDamage();
-
-        soldier->setMoveSpeed(currentMoveSpeed * _ratio);
-        soldier->setAttackSpeed(currentAttackSpeed * _ratio);
-        soldier->setAttackDamage(currentAttackDamage * _ratio);
-
-        // 记录受影响的士兵
-        _affectedSoldiers.insert(soldier);
-
-        CCLOG(
-            "RageSpell: Boosted soldier attributes (Move: %.1f->%.1f, "
-            "AttackSpeed: %.1f->%.1f, AttackDamage: %.1f->%.1f, Ratio: %.2f)",
-            currentMoveSpeed, currentMoveSpeed * _ratio, currentAttackSpeed,
-            currentAttackSpeed * _ratio, currentAttackDamage,
-            currentAttackDamage * _ratio, _ratio);
-      }
-    }
-  }
-}
-
-void RageSpell::updateEffect(float delta,
-                             const std::vector<BasicSoldier*>& soldiers,
-                             const std::vector<Building*>& buildings) {
-  // 持续效果：检查范围内的士兵，对新进入范围的士兵应用效果
-  std::set<BasicSoldier*> soldiersInRange;
-
-  // 收集当前在范围内的士兵
-  for (BasicSoldier* soldier : soldiers) {
-    if (soldier && soldier->isAlive()) {
-      Vec2 soldierPos = soldier->getPosition();
-      if (isInRange(soldierPos, _castPosition, _radius)) {
-        soldiersInRange.insert(soldier);
-
-        // 如果还没有受到效果影响，使用乘法提升属性
-        if (_affectedSoldiers.find(soldier) == _affectedSoldiers.end()) {
-          float currentMoveSpeed = soldier->getMoveSpeed();
-          float currentAttackSpeed = soldier->getAttackSpeed();
-          float currentAttackDamage = soldier->getAttackDamage();
-
-          soldier->setMoveSpeed(currentMoveSpeed * _ratio);
-          soldier->setAttackSpeed(currentAttackSpeed * _ratio);
-          soldier->setAttackDamage(currentAttackDamage * _ratio);
-
-          _affectedSoldiers.insert(soldier);
-        }
-      }
-    }
-  }
-
-  // 对于离开范围的士兵，使用除法移除效果
-  auto it = _affectedSoldiers.begin();
-  while (it != _affectedSoldiers.end()) {
-    BasicSoldier* soldier = *it;
-    // 检查士兵是否还在范围内或已死亡
-    if (!soldier || !soldier->isAlive() ||
-        soldiersInRange.find(soldier) == soldiersInRange.end()) {
-      // 使用除法恢复属性
-      if (soldier && soldier->isAlive()) {
-        float currentMoveSpeed = soldier->getMoveSpeed();
-        float currentAttackSpeed = soldier->getAttackSpeed();
-        float currentAttackDamage = soldier->getAttackDamage();
-
-        soldier->setMoveSpeed(currentMoveSpeed / _ratio);
-        soldier->setAttackSpeed(currentAttackSpeed / _ratio);
-        soldier->setAttackDamage(currentAttackDamage / _ratio);
-      }
-      it = _affectedSoldiers.erase(it);
-    } else {
-      ++it;
-    }
-  }
-}
-
 void RageSpell::createVisualEffect() {
   // 创建紫色狂暴圈效果（带透明度）
   auto drawNode = DrawNode::create();
@@ -136,27 +48,3 @@ void RageSpell::createVisualEffect() {
   this->addChild(drawNode);
   _visualEffectNode = drawNode;
 }
-
-void RageSpell::onSpellEnd() {
-  // 使用除法恢复所有受影响士兵的属性
-  for (BasicSoldier* soldier : _affectedSoldiers) {
-    if (soldier && soldier->isAlive()) {
-      float currentMoveSpeed = soldier->getMoveSpeed();
-      float currentAttackSpeed = soldier->getAttackSpeed();
-      float currentAttackDamage = soldier->getAttackDamage();
-
-      soldier->setMoveSpeed(currentMoveSpeed / _ratio);
-      soldier->setAttackSpeed(currentAttackSpeed / _ratio);
-      soldier->setAttackDamage(currentAttackDamage / _ratio);
-
-      CCLOG(
-          "RageSpell: Restored soldier attributes (Move: %.1f->%.1f, "
-          "AttackSpeed: %.1f->%.1f, AttackDamage: %.1f->%.1f)",
-          currentMoveSpeed, currentMoveSpeed / _ratio, currentAttackSpeed,
-          currentAttackSpeed / _ratio, currentAttackDamage,
-          currentAttackDamage / _ratio);
-    }
-  }
-
-  _affectedSoldiers.clear();
-}
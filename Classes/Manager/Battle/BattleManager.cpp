@@ -0,0 +1,218 @@
+#include "BattleManager.h"
+
+#include "Game/Building/TrapBuilding.h"
+#include "Game/Spell/HealSpell.h"
+#include "Game/Spell/LightningSpell.h"
+#include "Game/Spell/RageSpell.h"
+#include "Manager/Building/BuildingManager.h"
+#include "Utils/GridUtils.h"
+
+namespace {
+// 后台寻路线程数，寻路结果与线程数无关
+const int kPathThreadCount = 2;
+}  // namespace
+
+BattleManager::BattleManager(BuildingManager* buildingManager, Node* mapLayer,
+                             const Vec2& p00)
+    : _buildingManager(buildingManager),
+      _mapLayer(mapLayer),
+      _world(GridUtils::getProjection(p00)) {
+  // 地面士兵的寻路放到后台线程，不占用渲染帧
+  _world.enableAsyncPathfinding(kPathThreadCount,
+                                BattlePathService::DEFAULT_BUDGET);
+}
+
+BattleManager::~BattleManager() {}
+
+bool BattleManager::init() {
+  if (!_buildingManager || !_mapLayer) {
+    CCLOG("BattleManager: missing building manager or map layer");
+    return false;
+  }
+
+  // 建筑 id 与 _buildingViews 的下标一一对应
+  for (Building* building : _buildingManager->getAllBuildings()) {
+    if (!building) {
+      continue;
+    }
+    int id = _world.addBuilding(
+        building->getBuildingName(), building->getLevel(),
+        building->getBattleStats(), building->getRow(), building->getCol(),
+        building->getCurrentHP());
+    _buildingViews.push_back(building);
+    _trapArmed.push_back(_world.getBuildings()[id].armed);
+  }
+  _buildingDirty.assign(_buildingViews.size(), false);
+
+  return true;
+}
+
+BasicSoldier* BattleManager::deploySoldier(SoldierType soldierType, int level,
+                                           const Vec2& position) {
+  auto soldier = _soldierPool.acquire(soldierType, level);
+  if (!soldier) {
+    return nullptr;
+  }
+
+  soldier->setPosition(position);
+  _mapLayer->addChild(soldier, 5);
+
+  BattleVec2 battlePosition(position.x, position.y);
+  int id = _world.addSoldier(soldierType, level, soldier->getBattleStats(),
+                             battlePosition);
+
+  // 复用了死亡士兵的槽位时替换其精灵
+  if (id >= static_cast<int>(_soldierViews.size())) {
+    _soldierViews.resize(id + 1, nullptr);
+    _previousPositions.resize(id + 1);
+  } else if (_soldierViews[id]) {
+    _soldierPool.release(_soldierViews[id]);
+  }
+  _soldierViews[id] = soldier;
+  _previousPositions[id] = battlePosition;
+  return soldier;
+}
+
+BasicSpell* BattleManager::castSpell(SpellType spellType,
+                                     const Vec2& position) {
+  BasicSpell* spell = nullptr;
+  switch (spellType) {
+    case SpellType::HEAL:
+      spell = HealSpell::create();
+      break;
+    case SpellType::LIGHTNING:
+      spell = LightningSpell::create();
+      break;
+    case SpellType::RAGE:
+      spell = RageSpell::create();
+      break;
+  }
+
+  if (!spell || !spell->cast(position)) {
+    return nullptr;
+  }
+
+  _mapLayer->addChild(spell, 8);
+  int id = _world.castSpell(spellType, spell->getBattleStats(),
+                            BattleVec2(position.x, position.y));
+  if (id >= static_cast<int>(_spellViews.size())) {
+    _spellViews.resize(id + 1, nullptr);
+  } else if (_spellViews[id]) {
+    _spellViews[id]->removeFromParent();
+  }
+  _spellViews[id] = spell;
+  return spell;
+}
+
+void BattleManager::update(float dt) {
+  _clock.beginFrame(dt);
+  while (_clock.consumeTick()) {
+    if (_tickCallback) {
+      _tickCallback(_clock.getTick() - 1);
+    }
+
+    // 记录模拟前的位置，用于渲染插值
+    const auto& soldiers = _world.getSoldiers();
+    _previousPositions.resize(soldiers.size());
+    for (int i = 0; i < soldiers.size(); ++i) {
+      _previousPositions[i] = soldiers.position(i);
+    }
+
+    _world.update(_clock.getTickDelta());
+
+    // 死亡士兵的槽位可能在下一逻辑帧被复用，立即同步死亡表现
+    for (int id : _world.getDamageReport().killedSoldiers) {
+      if (_soldierViews[id]) {
+        BattleVec2 position = soldiers.position(id);
+        _soldierViews[id]->syncFromBattle(
+            soldiers, id, Vec2(static_cast<float>(position.x),
+                               static_cast<float>(position.y)));
+      }
+    }
+
+    // 一个渲染帧内可能运行多个逻辑帧，受伤的建筑合并到帧末统一刷新
+    for (int id : _world.getDamageReport().damagedBuildings) {
+      if (!_buildingDirty[id]) {
+        _buildingDirty[id] = true;
+        _damagedBuildings.push_back(id);
+      }
+    }
+  }
+
+  syncViews(_clock.getAlpha());
+}
+
+void BattleManager::syncViews(float alpha) {
+  // 同步本帧受到伤害的建筑，每个建筑只刷新一次
+  const auto& buildings = _world.getBuildings();
+  for (int id : _damagedBuildings) {
+    _buildingDirty[id] = false;
+    const BattleBuilding& building = buildings[id];
+    Building* view = _buildingViews[id];
+    if (!view || !view->isAlive()) {
+      continue;
+    }
+
+    if (!building.isAlive()) {
+      // 通过 takeDamage 触发死亡回调，释放 BuildingManager 中的网格并隐藏建筑
+      view->takeDamage(view->getCurrentHP());
+    } else {
+      view->setCurrentHPAndUpdate(static_cast<float>(building.hp));
+    }
+  }
+  _damagedBuildings.clear();
+
+  // 陷阱爆炸特效
+  for (size_t i = 0; i < buildings.size(); ++i) {
+    const BattleBuilding& building = buildings[i];
+    if (_trapArmed[i] && !building.armed) {
+      TrapBuilding* trap = dynamic_cast<TrapBuilding*>(_buildingViews[i]);
+      if (trap) {
+        trap->playExplosionEffect();
+      }
+    }
+    _trapArmed[i] = building.armed;
+  }
+
+  // 同步士兵（在上一逻辑帧和当前逻辑帧之间插值）
+  const auto& soldiers = _world.getSoldiers();
+  for (int i = 0; i < soldiers.size(); ++i) {
+    if (!_soldierViews[i]) {
+      continue;
+    }
+    const BattleVec2& previous = _previousPositions[i];
+    BattleVec2 position = soldiers.position(i);
+    position = previous + (position - previous) * alpha;
+    Vec2 renderPosition(static_cast<float>(position.x),
+                        static_cast<float>(position.y));
+    _soldierViews[i]->syncFromBattle(soldiers, i, renderPosition);
+  }
+
+  // 移除已结束的法术表现
+  const auto& spells = _world.getSpells();
+  for (size_t i = 0; i < spells.size(); ++i) {
+    if (_spellViews[i] && !spells[i].active) {
+      _spellViews[i]->removeFromParent();
+      _spellViews[i] = nullptr;
+    }
+  }
+}
+
+void BattleManager::clearUnits(bool removeSoldiers) {
+  for (BasicSpell* spell : _spellViews) {
+    if (spell) {
+      spell->removeFromParent();
+    }
+  }
+  _spellViews.clear();
+
+  if (removeSoldiers) {
+    for (BasicSoldier* soldier : _soldierViews) {
+      _soldierPool.release(soldier);
+    }
+  }
+  _soldierViews.clear();
+  _previousPositions.clear();
+  _world.clearUnits();
+  _clock.reset();
+}
@@ -0,0 +1,142 @@
+#ifndef __BATTLE_MANAGER_H__
+#define __BATTLE_MANAGER_H__
+
+#include <functional>
+#include <vector>
+
+#include "Battle/BattleClock.h"
+#include "Battle/BattleWorld.h"
+#include "Game/Building/Building.h"
+#include "Game/Soldier/BasicSoldier.h"
+#include "Game/Soldier/SoldierPool.h"
+#include "Game/Spell/BasicSpell.h"
+#include "cocos2d.h"
+
+USING_NS_CC;
+
+class BuildingManager;
+
+/**
+ * 战斗管理器
+ * 将场景中的建筑、士兵和法术注册到无头战斗核心 BattleWorld，
+ * 按 BattleClock 的固定步长推进战斗并把结果同步回精灵
+ */
+class BattleManager {
+ public:
+  /**
+   * 构造函数
+   * @param buildingManager 建筑管理器（提供地图中的建筑）
+   * @param mapLayer 士兵和法术所在的地图层
+   * @param p00 地图原点p[0][0]的位置
+   */
+  BattleManager(BuildingManager* buildingManager, Node* mapLayer,
+                const Vec2& p00);
+
+  /**
+   * 析构函数
+   */
+  ~BattleManager();
+
+  /**
+   * 初始化战斗，将所有建筑注册到战斗核心
+   * @return 是否初始化成功
+   */
+  bool init();
+
+  /**
+   * 预先创建士兵精灵，部署时直接从对象池中取出
+   * @param soldierType 士兵类型
+   * @param level 士兵等级
+   * @param count 预计部署的数量
+   */
+  void prewarmSoldiers(SoldierType soldierType, int level, int count) {
+    _soldierPool.prewarm(soldierType, level, count);
+  }
+
+  /**
+   * 在指定位置放置士兵
+   * @param soldierType 士兵类型
+   * @param level 士兵等级
+   * @param position 地图层坐标
+   * @return 士兵精灵，失败返回nullptr
+   */
+  BasicSoldier* deploySoldier(SoldierType soldierType, int level,
+                              const Vec2& position);
+
+  /**
+   * 在指定位置施放法术
+   * @param spellType 法术类型
+   * @param position 地图层坐标
+   * @return 法术精灵，失败返回nullptr
+   */
+  BasicSpell* castSpell(SpellType spellType, const Vec2& position);
+
+  /**
+   * 推进战斗并同步精灵（每帧调用）
+   * 按固定步长运行 0 到多个逻辑帧，士兵位置在最近两个逻辑帧之间插值
+   * @param dt 渲染帧时间间隔
+   */
+  void update(float dt);
+
+  /**
+   * 逻辑帧回调：在每个逻辑帧模拟之前调用，参数为已完成的逻辑帧数
+   * 回放场景在这里按逻辑帧布置士兵和法术，保证与进攻时一致
+   */
+  using TickCallback = std::function<void(int tick)>;
+  void setTickCallback(TickCallback callback) { _tickCallback = callback; }
+
+  /**
+   * 设置播放速度倍数（1、2、4、8）
+   */
+  void setSpeed(int speed) { _clock.setSpeed(speed); }
+  int getSpeed() const { return _clock.getSpeed(); }
+
+  /**
+   * 已完成的逻辑帧数
+   */
+  int getTick() const { return _clock.getTick(); }
+
+  /**
+   * 逻辑帧率（Hz）
+   */
+  int getTickRate() const { return _clock.getTickRate(); }
+
+  /**
+   * 已模拟的战斗时间（秒）
+   */
+  float getBattleTime() const { return _clock.getElapsed(); }
+
+  /**
+   * 移除所有法术表现并清空战斗中的士兵和法术，战斗时钟归零
+   * @param removeSoldiers 是否同时移除士兵精灵（否则冻结在原地）
+   */
+  void clearUnits(bool removeSoldiers = false);
+
+  /**
+   * 获取战斗核心
+   */
+  const BattleWorld& getWorld() const { return _world; }
+
+ private:
+  /**
+   * 将战斗结果同步到精灵
+   * @param alpha 渲染插值系数
+   */
+  void syncViews(float alpha);
+
+  BuildingManager* _buildingManager;         // 建筑管理器
+  Node* _mapLayer;                           // 地图层
+  BattleWorld _world;                        // 战斗核心
+  BattleClock _clock;                        // 战斗时钟
+  TickCallback _tickCallback;                // 逻辑帧回调
+  std::vector<Building*> _buildingViews;     // 按建筑 id 索引的建筑精灵
+  SoldierPool _soldierPool;                  // 士兵精灵对象池
+  std::vector<BasicSoldier*> _soldierViews;  // 按士兵 id 索引的士兵精灵
+  std::vector<BasicSpell*> _spellViews;      // 按法术 id 索引的法术精灵
+  std::vector<bool> _trapArmed;              // 上一帧的陷阱布防状态
+  std::vector<bool> _buildingDirty;          // 建筑是否在待刷新列表中
+  std::vector<int> _damagedBuildings;        // 本渲染帧内受伤的建筑 id
+  std::vector<BattleVec2> _previousPositions;  // 上一逻辑帧的士兵位置
+};
+
+#endif  // __BATTLE_MANAGER_H__
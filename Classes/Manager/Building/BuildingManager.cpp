@@ -31,10 +31,10 @@
 BuildingManager::BuildingManager(const std::string& jsonFilePath,
                                  const Vec2& p00)
     : _jsonFilePath(jsonFilePath), _p00(p00), _isLoading(false) {
-  // 初始化网格地图为可通行 (0)
+  // 初始化网格地图为可通行
   for (int i = 0; i < MAP_GRID_SIZE; ++i) {
     for (int j = 0; j < MAP_GRID_SIZE; ++j) {
-      _gridMap[i][j] = 0;
+      _gridMap[i][j] = nullptr;
     }
   }
 }
@@ -45,36 +45,70 @@ bool BuildingManager::isWalkable(int row, int col) const {
   if (!isValidGrid(row, col)) {
     return false;
   }
-  return _gridMap[row][col] == 0;
+  return _gridMap[row][col] == nullptr;
 }
 
 bool BuildingManager::isValidGrid(int row, int col) const {
   return row >= 0 && row < MAP_GRID_SIZE && col >= 0 && col < MAP_GRID_SIZE;
 }
 
-void BuildingManager::updateGridState(int row, int col, int size,
-                                      bool blocked) {
-  // 假设 row, col 是中心点
-  // 计算左下角起始点
-  // 对于奇数 size (1, 3, 5): 中心在网格中心。范围 [c - s/2, c + s/2]
-  // 对于偶数 size (2, 4): 中心在顶点。范围 [c - s/2, c + s/2 - 1]
+void BuildingManager::updateGridState(Building* building, bool blocked) {
+  // row, col 是中心网格坐标（偶数尺寸时为中心顶点）
+  // 奇数 size (1, 3, 5): 范围 [c - s/2, c + s/2]
+  // 偶数 size (2, 4): 范围 [c - s/2, c + s/2 - 1]
+  int size = building->getGridCount();
+  int startRow = static_cast<int>(building->getRow()) - size / 2;
+  int startCol = static_cast<int>(building->getCol()) - size / 2;
 
-  // 修正：根据 createBuilding 中的逻辑
-  // if (gridCount % 2 != 0) anchorPos.x += _deltaX;
-  // 这意味着奇数尺寸时，传入的 row/col
-  // 对应的是网格坐标的整数部分，但实际中心偏移了。 让我们统一使用：row/col
-  // 是中心网格坐标（或中心顶点坐标）。
+  for (int r = startRow; r < startRow + size; ++r) {
+    for (int c = startCol; c < startCol + size; ++c) {
+      if (!isValidGrid(r, c)) {
+        continue;
+      }
+      if (blocked) {
+        _gridMap[r][c] = building;
+      } else if (_gridMap[r][c] == building) {
+        // 只释放自己占用的网格，不影响重叠摆放的其他建筑
+        _gridMap[r][c] = nullptr;
+      }
+    }
+  }
+}
+
+void BuildingManager::clearGridOwner(Building* building) {
+  for (int r = 0; r < MAP_GRID_SIZE; ++r) {
+    for (int c = 0; c < MAP_GRID_SIZE; ++c) {
+      if (_gridMap[r][c] == building) {
+        _gridMap[r][c] = nullptr;
+      }
+    }
+  }
+}
 
-  int startRow = row - size / 2;
-  int startCol = col - size / 2;
+void BuildingManager::updateBuildingGrid(Building* building) {
+  if (!building) {
+    return;
+  }
+  // 移动前的坐标已经丢失，按占用表整张清除
+  clearGridOwner(building);
+  if (building->isAlive()) {
+    updateGridState(building, true);
+  }
+}
 
+bool BuildingManager::isAreaOccupied(const Building* building) const {
+  int size = building->getGridCount();
+  int startRow = static_cast<int>(building->getRow()) - size / 2;
+  int startCol = static_cast<int>(building->getCol()) - size / 2;
   for (int r = startRow; r < startRow + size; ++r) {
     for (int c = startCol; c < startCol + size; ++c) {
-      if (isValidGrid(r, c)) {
-        _gridMap[r][c] = blocked ? 1 : 0;
+      if (isValidGrid(r, c) && _gridMap[r][c] &&
+          _gridMap[r][c] != building) {
+        return true;
       }
     }
   }
+  return false;
 }
 
 bool BuildingManager::init() {
@@ -393,47 +427,20 @@ Building* BuildingManager::createBuilding(const std::string& buildingName,
 }
 
 Building* BuildingManager::getBuildingAtPosition(const Vec2& pos) const {
-  auto configManager = ConfigManager::getInstance();
-  if (!configManager) {
+  float row, col;
+  if (!GridUtils::screenToGrid(pos, _p00, row, col)) {
     return nullptr;
   }
-  // 从后往前遍历（后添加的建筑在上层）
-  for (auto it = _buildings.rbegin(); it != _buildings.rend(); ++it) {
-    Building* building = *it;
-    if (!building) {
-      continue;
-    }
-    // TODO
-    // 判断点是否在建筑的菱形区域内
-    if (building->inDiamond(pos)) {
-      return building;
-    }
-  }
-
-  return nullptr;
+  // 点所在的网格即点击到的建筑（占用表中后登记的建筑在上层）
+  return getBuildingAtGrid(static_cast<int>(std::floor(row)),
+                           static_cast<int>(std::floor(col)));
 }
 
 Building* BuildingManager::getBuildingAtGrid(int row, int col) const {
-  for (Building* building : _buildings) {
-    if (building && building->isAlive()) {
-      // 建筑中心坐标
-      float bRow = building->getRow();
-      float bCol = building->getCol();
-      int gridSize = building->getGridCount();
-
-      // 建筑占据的范围是从 center - size/2 到 center + size/2
-      float halfSize = gridSize / 2.0f;
-
-      // 检查点 (row, col) 是否在建筑范围内
-      // 注意：这里使用简单的矩形范围检查，因为网格坐标系本身是正交的（虽然渲染是菱形）
-      // 建筑占据的网格是 [bRow - halfSize, bRow + halfSize)
-      if (row >= bRow - halfSize && row < bRow + halfSize &&
-          col >= bCol - halfSize && col < bCol + halfSize) {
-        return building;
-      }
-    }
+  if (!isValidGrid(row, col)) {
+    return nullptr;
   }
-  return nullptr;
+  return _gridMap[row][col];
 }
 
 void BuildingManager::addBuildingsToLayer(Layer* layer) {
@@ -461,6 +468,11 @@ void BuildingManager::clearAllBuildings() {
     }
   }
   _buildings.clear();
+  for (int i = 0; i < MAP_GRID_SIZE; ++i) {
+    for (int j = 0; j < MAP_GRID_SIZE; ++j) {
+      _gridMap[i][j] = nullptr;
+    }
+  }
 }
 
 void BuildingManager::registerBuilding(Building* building) {
@@ -480,18 +492,16 @@ void BuildingManager::registerBuilding(Building* building) {
   // 设置死亡回调
   building->setOnDeathCallback([this](Building* b) {
     // 建筑被摧毁时，更新网格状态为可通行
-    this->updateGridState(static_cast<int>(b->getRow()),
-                          static_cast<int>(b->getCol()), b->getGridCount(),
-                          false);
+    this->updateGridState(b, false);
     // 注意：这里不立即移除建筑，避免迭代器失效或悬空指针
     // 建筑对象会被保留在 _buildings 中直到场景销毁
     // 但 isAlive() 会返回 false，所以逻辑上已经死亡
   });
 
   // 更新网格状态
-  updateGridState(static_cast<int>(building->getRow()),
-                  static_cast<int>(building->getCol()),
-                  building->getGridCount(), true);
+  if (building->isAlive()) {
+    updateGridState(building, true);
+  }
 
   // 更新资源统计
   updatePlayerResourcesStats();
@@ -554,10 +564,8 @@ void BuildingManager::removeBuilding(Building* building) {
   if (!building) return;
   auto it = std::find(_buildings.begin(), _buildings.end(), building);
   if (it != _buildings.end()) {
-    // 更新网格状态
-    updateGridState(static_cast<int>(building->getRow()),
-                    static_cast<int>(building->getCol()),
-                    building->getGridCount(), false);
+    // 更新网格状态（拖动未放下的建筑坐标可能已经变化，按占用表清除）
+    clearGridOwner(building);
 
     _buildings.erase(it);
     updatePlayerResourcesStats();
@@ -589,22 +597,15 @@ bool BuildingManager::getBuildingResult(int& stars, float& ratio, bool& win) {
     }
   }
 
-  if (totalCount == 0) {
+  BattleResult result;
+  if (!BattleResult::evaluate(totalCount, destroyedCount, townHallDestroyed,
+                              result)) {
     return false;
   }
 
-  ratio = static_cast<float>(destroyedCount) / totalCount;
-
-  // 星级判定
-  if (ratio >= 1.0f) {
-    stars = 3;
-  } else if (ratio >= 0.5f) {
-    stars = townHallDestroyed ? 2 : 1;
-  } else {
-    stars = townHallDestroyed ? 1 : 0;
-  }
-
-  win = (stars >= 1);
+  stars = result.stars;
+  ratio = result.ratio;
+  win = result.win;
 
   // 同步成员变量
   _ratio = ratio;
@@ -38,19 +38,31 @@ class BuildingManager {
 
   /**
    * 检查指定位置是否有建筑被点击
+   * 换算到网格后查占用表，与建筑数量无关
    * @param pos Layer坐标
    * @return 被点击的建筑指针，如果没有则返回nullptr
    */
   Building* getBuildingAtPosition(const Vec2& pos) const;
 
   /**
-   * 获取指定网格上的建筑
+   * 获取指定网格上的建筑（只包含存活的建筑）
    * @param row 行坐标
    * @param col 列坐标
    * @return 建筑指针，如果没有则返回nullptr
    */
   Building* getBuildingAtGrid(int row, int col) const;
 
+  /**
+   * 建筑移动后重新登记它占用的网格
+   * 拖动建筑只修改建筑自身的坐标，放下后需要调用
+   */
+  void updateBuildingGrid(Building* building);
+
+  /**
+   * 建筑按当前坐标占用的网格上是否已有其他建筑（用于放置检测）
+   */
+  bool isAreaOccupied(const Building* building) const;
+
   /**
    * 添加建筑到场景
    * @param layer 要添加到的图层
@@ -126,14 +138,18 @@ class BuildingManager {
  private:
   /**
    * 更新网格状态
-   * @param row 起始行坐标
-   * @param col 起始列坐标
-   * @param size 占用网格大小（边长）
-   * @param blocked 是否阻挡
+   * @param building 占用或释放网格的建筑
+   * @param blocked true 时登记为该建筑占用；false 时释放仍由它占用的网格
+   */
+  void updateGridState(Building* building, bool blocked);
+
+  /**
+   * 释放建筑占用的全部网格（不依赖建筑当前的坐标）
    */
-  void updateGridState(int row, int col, int size, bool blocked);
+  void clearGridOwner(Building* building);
 
-  int _gridMap[MAP_GRID_SIZE][MAP_GRID_SIZE];  // 0: Passable, 1: Blocked
+  // 每个网格上的建筑，nullptr 表示可通行
+  Building* _gridMap[MAP_GRID_SIZE][MAP_GRID_SIZE];
 
   /**
    * 从配置文件加载建筑地图
@@ -367,17 +367,7 @@ ConfigManager::SoldierConfig ConfigManager::getSoldierConfig(
   if (soldierTypeConfig.HasMember("AttackType") &&
       soldierTypeConfig["AttackType"].IsString()) {
     std::string attackTypeStr = soldierTypeConfig["AttackType"].GetString();
-    if (attackTypeStr == "Any") {
-      config.attackType = AttackType::ANY;
-    } else if (attackTypeStr == "Defense") {
-      config.attackType = AttackType::DEFENSE;
-    } else if (attackTypeStr == "Resource") {
-      config.attackType = AttackType::RESOURCE;
-    } else if (attackTypeStr == "TownHall") {
-      config.attackType = AttackType::TOWN_HALL;
-    } else if (attackTypeStr == "WALL") {
-      config.attackType = AttackType::WALL;
-    } else {
+    if (!BattleTypeUtils::parseAttackType(attackTypeStr, config.attackType)) {
       CCLOG("Invalid attack type: %s", attackTypeStr.c_str());
       return config;
     }
@@ -386,11 +376,8 @@ ConfigManager::SoldierConfig ConfigManager::getSoldierConfig(
   if (soldierTypeConfig.HasMember("SoldierType") &&
       soldierTypeConfig["SoldierType"].IsString()) {
     std::string soldierTypeStr = soldierTypeConfig["SoldierType"].GetString();
-    if (soldierTypeStr == "LAND") {
-      config.soldierCategory = SoldierCategory::LAND;
-    } else if (soldierTypeStr == "AIR") {
-      config.soldierCategory = SoldierCategory::AIR;
-    } else {
+    if (!BattleTypeUtils::parseSoldierCategory(soldierTypeStr,
+                                               config.soldierCategory)) {
       CCLOG("Invalid soldier type: %s", soldierTypeStr.c_str());
       return config;
     }
@@ -481,11 +468,7 @@ ConfigManager::SpellConfig ConfigManager::getSpellConfig(
   if (spellTypeConfig.HasMember("Category") &&
       spellTypeConfig["Category"].IsString()) {
     std::string categoryStr = spellTypeConfig["Category"].GetString();
-    if (categoryStr == "INSTANT") {
-      config.category = SpellCategory::INSTANT;
-    } else if (categoryStr == "DURATION") {
-      config.category = SpellCategory::DURATION;
-    } else {
+    if (!BattleTypeUtils::parseSpellCategory(categoryStr, config.category)) {
       CCLOG("Invalid spell category: %s", categoryStr.c_str());
       return config;
     }
@@ -37,7 +37,8 @@ void RecordManager::startAttack() {
 }
 
 void RecordManager::recordTroopPlacement(const std::string& category, int level,
-                                         float x, float y, int timestamp) {
+                                         float x, float y, int timestamp,
+                                         int tick) {
   if (!_isRecording) {
     return;
   }
@@ -49,12 +50,13 @@ void RecordManager::recordTroopPlacement(const std::string& category, int level,
   record.x = x;
   record.y = y;
   record.timestamp = timestamp;
+  record.tick = tick;
 
   _records.push_back(record);
 }
 
 void RecordManager::recordSpellPlacement(const std::string& category, float x,
-                                         float y, int timestamp) {
+                                         float y, int timestamp, int tick) {
   if (!_isRecording) {
     return;
   }
@@ -66,6 +68,7 @@ void RecordManager::recordSpellPlacement(const std::string& category, float x,
   record.x = x;
   record.y = y;
   record.timestamp = timestamp;
+  record.tick = tick;
 
   _records.push_back(record);
 }
@@ -118,6 +121,9 @@ bool RecordManager::endAttackAndSave(const std::string& filePath) {
 
     // 添加时间戳
     recordObj.AddMember("timestamp", record.timestamp, allocator);
+    if (record.tick >= 0) {
+      recordObj.AddMember("tick", record.tick, allocator);
+    }
 
     recordsArray.PushBack(recordObj, allocator);
   }
@@ -19,6 +19,7 @@ struct PlacementRecord {
   float x;               // 地图坐标X
   float y;               // 地图坐标Y
   int timestamp;         // 时间戳（从开始进攻算起的秒数）
+  int tick = -1;         // 战斗时钟的逻辑帧序号（-1 表示旧记录，按时间戳回放）
 };
 
 /**
@@ -42,15 +43,17 @@ class RecordManager {
 
   /**
    * 记录兵种布置
+   * @param tick 布置时战斗时钟已完成的逻辑帧数
    */
   void recordTroopPlacement(const std::string& category, int level, float x,
-                            float y, int timestamp);
+                            float y, int timestamp, int tick = -1);
 
   /**
    * 记录法术布置
+   * @param tick 布置时战斗时钟已完成的逻辑帧数
    */
   void recordSpellPlacement(const std::string& category, float x, float y,
-                            int timestamp);
+                            int timestamp, int tick = -1);
 
   /**
    * 结束进攻并保存记录到JSON文件
@@ -0,0 +1,240 @@
+#include "Sim/AttackOptimizer.h"
+
+#include <algorithm>
+
+#include "Sim/SimThreadPool.h"
+
+AttackOptimizer::AttackOptimizer(const BattleSimulator& simulator,
+                                 const BattleProjection& projection,
+                                 const SimArmy& army,
+                                 const AttackOptimizerOptions& options)
+    : _simulator(simulator),
+      _projection(projection),
+      _options(options),
+      _groupCount(0) {
+  _options.population = std::max(_options.population, 2);
+  _options.eliteCount =
+      std::min(std::max(_options.eliteCount, 0), _options.population - 1);
+  _options.tournamentSize = std::max(_options.tournamentSize, 1);
+  _maxDeployTick = std::max(
+      0, static_cast<int>(_options.deployWindow * simulator.getTickRate()));
+
+  for (const SimTroopItem& troop : army.troops) {
+    if (troop.count <= 0) {
+      continue;
+    }
+    for (int i = 0; i < troop.count; ++i) {
+      _units.push_back({"troop", troop.category, troop.level, _groupCount});
+    }
+    _groupCount++;
+  }
+  for (const SimSpellItem& spell : army.spells) {
+    if (spell.count <= 0) {
+      continue;
+    }
+    for (int i = 0; i < spell.count; ++i) {
+      _units.push_back({"spell", spell.category, 1, _groupCount});
+    }
+    _groupCount++;
+  }
+}
+
+AttackPlanResult AttackOptimizer::optimize(
+    const std::vector<SimBuildingPlacement>& layout,
+    const SimThreadPool& pool) const {
+  AttackPlanResult result;
+  Candidate best;
+  best.score = -1.0f;
+
+  for (int restart = 0; restart < std::max(_options.restarts, 1);
+       ++restart) {
+    std::mt19937 rng(_options.seed + restart * 7919u);
+
+    std::vector<Candidate> population;
+    population.reserve(_options.population);
+    for (int i = 0; i < _options.population; ++i) {
+      population.push_back(randomCandidate(rng));
+    }
+    evaluate(layout, population, 0, pool);
+    result.evaluations += _options.population;
+
+    for (int generation = 0; generation < _options.generations;
+         ++generation) {
+      // 分数相同的个体保持原有顺序，同一种子在各个标准库上选出相同的精英
+      std::stable_sort(population.begin(), population.end(),
+                       [](const Candidate& a, const Candidate& b) {
+                         return a.score > b.score;
+                       });
+
+      // 精英直接保留，其余由选择、交叉、变异产生，只需模拟新个体
+      std::vector<Candidate> next(population.begin(),
+                                  population.begin() + _options.eliteCount);
+      while (static_cast<int>(next.size()) < _options.population) {
+        Candidate child = crossover(select(population, rng),
+                                    select(population, rng), rng);
+        mutate(child, rng);
+        next.push_back(child);
+      }
+      evaluate(layout, next, _options.eliteCount, pool);
+      result.evaluations += _options.population - _options.eliteCount;
+      population.swap(next);
+    }
+
+    for (const Candidate& candidate : population) {
+      if (candidate.score > best.score) {
+        best = candidate;
+      }
+    }
+  }
+
+  result.record = toRecord(best);
+  result.report = _simulator.run(layout, result.record);
+  result.score = score(result.report, result.record.duration);
+  return result;
+}
+
+float AttackOptimizer::score(const SimReport& report, int duration) {
+  float timeBonus = 0.0f;
+  if (duration > 0) {
+    timeBonus = 0.01f * std::max(0.0f, 1.0f - report.duration / duration);
+  }
+  return report.result.stars + report.result.ratio + timeBonus;
+}
+
+AttackOptimizer::Candidate AttackOptimizer::randomCandidate(
+    std::mt19937& rng) const {
+  std::uniform_real_distribution<float> position(
+      0.0f, static_cast<float>(_projection.gridSize));
+  std::uniform_int_distribution<int> tick(0, _maxDeployTick);
+  std::normal_distribution<float> spread(0.0f, _options.positionSigma);
+
+  // 同一分组的单位围绕一个随机中心部署
+  std::vector<Gene> centers(_groupCount);
+  for (Gene& center : centers) {
+    center.row = position(rng);
+    center.col = position(rng);
+    center.tick = tick(rng);
+  }
+
+  Candidate candidate;
+  candidate.score = 0.0f;
+  candidate.genes.reserve(_units.size());
+  for (const Unit& unit : _units) {
+    Gene gene = centers[unit.group];
+    gene.row += spread(rng);
+    gene.col += spread(rng);
+    clamp(gene);
+    candidate.genes.push_back(gene);
+  }
+  return candidate;
+}
+
+AttackOptimizer::Candidate AttackOptimizer::crossover(
+    const Candidate& a, const Candidate& b, std::mt19937& rng) const {
+  // 按分组均匀交叉，保留每个分组内部的部署形状
+  std::bernoulli_distribution pickA(0.5);
+  std::vector<char> fromA(_groupCount);
+  for (char& flag : fromA) {
+    flag = pickA(rng);
+  }
+
+  Candidate child;
+  child.score = 0.0f;
+  child.genes.resize(_units.size());
+  for (size_t i = 0; i < _units.size(); ++i) {
+    child.genes[i] = fromA[_units[i].group] ? a.genes[i] : b.genes[i];
+  }
+  return child;
+}
+
+void AttackOptimizer::mutate(Candidate& candidate, std::mt19937& rng) const {
+  std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+  std::normal_distribution<float> shift(0.0f, _options.positionSigma);
+  std::normal_distribution<float> tickShift(
+      0.0f, std::max(1.0f, _maxDeployTick * 0.1f));
+
+  for (int group = 0; group < _groupCount; ++group) {
+    if (chance(rng) >= _options.mutationRate) {
+      continue;
+    }
+
+    // 整组平移，或只扰动组内的单个单位
+    bool wholeGroup = chance(rng) < 0.5f;
+    float dRow = shift(rng);
+    float dCol = shift(rng);
+    int dTick = static_cast<int>(tickShift(rng));
+    for (size_t i = 0; i < _units.size(); ++i) {
+      if (_units[i].group != group) {
+        continue;
+      }
+      Gene& gene = candidate.genes[i];
+      if (wholeGroup) {
+        gene.row += dRow;
+        gene.col += dCol;
+        gene.tick += dTick;
+      } else if (chance(rng) < 0.3f) {
+        gene.row += shift(rng);
+        gene.col += shift(rng);
+      }
+      clamp(gene);
+    }
+  }
+}
+
+const AttackOptimizer::Candidate& AttackOptimizer::select(
+    const std::vector<Candidate>& population, std::mt19937& rng) const {
+  std::uniform_int_distribution<int> pick(
+      0, static_cast<int>(population.size()) - 1);
+  const Candidate* winner = &population[pick(rng)];
+  for (int i = 1; i < _options.tournamentSize; ++i) {
+    const Candidate& other = population[pick(rng)];
+    if (other.score > winner->score) {
+      winner = &other;
+    }
+  }
+  return *winner;
+}
+
+void AttackOptimizer::clamp(Gene& gene) const {
+  float maxCoord = static_cast<float>(_projection.gridSize - 1);
+  gene.row = std::min(std::max(gene.row, 0.0f), maxCoord);
+  gene.col = std::min(std::max(gene.col, 0.0f), maxCoord);
+  gene.tick = std::min(std::max(gene.tick, 0), _maxDeployTick);
+}
+
+SimRecord AttackOptimizer::toRecord(const Candidate& candidate) const {
+  SimRecord record;
+  record.placements.reserve(_units.size());
+  for (size_t i = 0; i < _units.size(); ++i) {
+    const Unit& unit = _units[i];
+    const Gene& gene = candidate.genes[i];
+    BattleVec2 position = _projection.gridToScene(gene.row, gene.col);
+
+    SimPlacement placement;
+    placement.type = unit.type;
+    placement.category = unit.category;
+    placement.level = unit.level;
+    placement.x = static_cast<float>(position.x);
+    placement.y = static_cast<float>(position.y);
+    placement.tick = gene.tick;
+    placement.timestamp = gene.tick / _simulator.getTickRate();
+    record.placements.push_back(placement);
+  }
+
+  std::stable_sort(record.placements.begin(), record.placements.end(),
+                   [](const SimPlacement& a, const SimPlacement& b) {
+                     return a.tick < b.tick;
+                   });
+  return record;
+}
+
+void AttackOptimizer::evaluate(const std::vector<SimBuildingPlacement>& layout,
+                               std::vector<Candidate>& candidates, int first,
+                               const SimThreadPool& pool) const {
+  int count = static_cast<int>(candidates.size()) - first;
+  pool.parallelFor(count, [&](int index) {
+    Candidate& candidate = candidates[first + index];
+    SimRecord record = toRecord(candidate);
+    candidate.score = score(_simulator.run(layout, record), record.duration);
+  });
+}
@@ -0,0 +1,115 @@
+#ifndef __ATTACK_OPTIMIZER_H__
+#define __ATTACK_OPTIMIZER_H__
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Sim/BattleSimulator.h"
+#include "Sim/SimScenario.h"
+
+class SimThreadPool;
+
+/**
+ * 进攻方案搜索参数
+ */
+struct AttackOptimizerOptions {
+  int restarts = 3;            // 随机重启次数（每次重新生成种群）
+  int population = 32;         // 种群大小
+  int generations = 20;        // 每次重启的进化代数
+  int eliteCount = 4;          // 直接保留到下一代的最优个体数
+  int tournamentSize = 3;      // 锦标赛选择的参赛个体数
+  float mutationRate = 0.2f;   // 每个兵种分组发生变异的概率
+  float positionSigma = 3.0f;  // 位置变异的标准差（格）
+  float deployWindow = 10.0f;  // 部署时间窗口（秒）
+  unsigned seed = 1;           // 随机种子，相同种子得到相同结果
+};
+
+/**
+ * 搜索得到的最优进攻方案
+ */
+struct AttackPlanResult {
+  SimRecord record;  // 可由 RecordScene 回放的进攻记录
+  SimReport report;  // 该记录的模拟结果
+  float score = 0.0f;
+  int evaluations = 0;  // 模拟的战斗总数
+};
+
+/**
+ * 进攻方案优化器
+ * 方案为军队中每个士兵/法术的部署位置（网格坐标）和部署帧。
+ * 搜索采用随机重启 + 遗传算法：同一兵种的部署点作为一个分组参与交叉和
+ * 整体平移，每一代的候选方案通过线程池并行模拟评分。
+ * 评分 = 星数 + 摧毁比例，同分时用时越短越好
+ */
+class AttackOptimizer {
+ public:
+  /**
+   * 构造函数
+   * @param simulator 模拟器，需在优化器的生命周期内保持有效
+   * @param projection 地图投影，用于把网格坐标换算为记录中的地图层坐标
+   * @param army 携带的军队和法术
+   */
+  AttackOptimizer(const BattleSimulator& simulator,
+                  const BattleProjection& projection, const SimArmy& army,
+                  const AttackOptimizerOptions& options);
+
+  /**
+   * 针对指定布局搜索最优方案
+   */
+  AttackPlanResult optimize(const std::vector<SimBuildingPlacement>& layout,
+                            const SimThreadPool& pool) const;
+
+  /**
+   * 战斗结果的评分
+   */
+  static float score(const SimReport& report, int duration);
+
+  /**
+   * 需要部署的单位总数
+   */
+  int getUnitCount() const { return static_cast<int>(_units.size()); }
+
+ private:
+  // 军队中的一个士兵或法术
+  struct Unit {
+    std::string type;  // "troop" 或 "spell"
+    std::string category;
+    int level;
+    int group;  // 所属分组（同一个 TroopItem/SpellItem）
+  };
+
+  // 一个单位的部署
+  struct Gene {
+    float row;
+    float col;
+    int tick;
+  };
+
+  struct Candidate {
+    std::vector<Gene> genes;
+    float score;
+  };
+
+  Candidate randomCandidate(std::mt19937& rng) const;
+  Candidate crossover(const Candidate& a, const Candidate& b,
+                      std::mt19937& rng) const;
+  void mutate(Candidate& candidate, std::mt19937& rng) const;
+  const Candidate& select(const std::vector<Candidate>& population,
+                          std::mt19937& rng) const;
+  void clamp(Gene& gene) const;
+
+  SimRecord toRecord(const Candidate& candidate) const;
+  void evaluate(const std::vector<SimBuildingPlacement>& layout,
+                std::vector<Candidate>& candidates, int first,
+                const SimThreadPool& pool) const;
+
+  const BattleSimulator& _simulator;
+  BattleProjection _projection;
+  AttackOptimizerOptions _options;
+  std::vector<Unit> _units;
+  int _groupCount;
+  int _maxDeployTick;
+};
+
+#endif  // __ATTACK_OPTIMIZER_H__
@@ -0,0 +1,238 @@
+#include "Sim/BalanceSweep.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <sstream>
+
+#include "Sim/BattleSimulator.h"
+#include "Sim/SimJson.h"
+#include "Sim/SimThreadPool.h"
+
+namespace {
+bool parseSpecDocument(const Json::Value& doc, SweepSpec& spec) {
+  if (!doc.isObject() || !doc["parameters"].isArray()) {
+    return false;
+  }
+
+  spec = SweepSpec();
+  if (doc["method"].isString()) {
+    spec.method = doc["method"].asString();
+  }
+  SimJson::readInt(doc, "samples", spec.samples);
+  if (doc["seed"].isUInt()) {
+    spec.seed = doc["seed"].asUInt();
+  }
+
+  for (const Json::Value& item : doc["parameters"]) {
+    if (!item.isObject() || !item["config"].isString() ||
+        !item["name"].isString() || !item["field"].isString()) {
+      return false;
+    }
+    SweepParameter parameter;
+    parameter.config = item["config"].asString();
+    parameter.name = item["name"].asString();
+    parameter.field = item["field"].asString();
+    SimJson::readInt(item, "level", parameter.level);
+    SimJson::readFloat(item, "min", parameter.min);
+    SimJson::readFloat(item, "max", parameter.max);
+    SimJson::readInt(item, "steps", parameter.steps);
+    spec.parameters.push_back(parameter);
+  }
+  return spec.method == "grid" || spec.method == "lhs";
+}
+
+// 一场战斗的结果，汇总前按任务下标保存，统计结果与线程数无关
+struct BattleOutcome {
+  bool valid = false;
+  bool win = false;
+  int stars = 0;
+  float ratio = 0.0f;
+};
+}  // namespace
+
+std::string SweepParameter::label() const {
+  std::ostringstream out;
+  out << config << "." << name << ".";
+  if (level > 0) {
+    out << level;
+  } else {
+    out << "all";
+  }
+  out << "." << field;
+  return out.str();
+}
+
+bool BalanceSweep::loadSpec(const std::string& path, SweepSpec& spec) {
+  Json::Value doc;
+  return SimJson::readFile(path, doc) && parseSpecDocument(doc, spec);
+}
+
+bool BalanceSweep::parseSpec(const std::string& text, SweepSpec& spec) {
+  Json::Value doc;
+  return SimJson::parse(text, doc) && parseSpecDocument(doc, spec);
+}
+
+std::vector<std::vector<float>> BalanceSweep::gridSamples(
+    const std::vector<SweepParameter>& parameters) {
+  std::vector<std::vector<float>> samples(1);
+  for (const SweepParameter& parameter : parameters) {
+    int steps = std::max(parameter.steps, 1);
+    std::vector<std::vector<float>> expanded;
+    expanded.reserve(samples.size() * steps);
+    for (const std::vector<float>& sample : samples) {
+      for (int i = 0; i < steps; ++i) {
+        float t = steps > 1 ? static_cast<float>(i) / (steps - 1) : 0.0f;
+        std::vector<float> next = sample;
+        next.push_back(parameter.min + (parameter.max - parameter.min) * t);
+        expanded.push_back(next);
+      }
+    }
+    samples.swap(expanded);
+  }
+  return samples;
+}
+
+std::vector<std::vector<float>> BalanceSweep::latinHypercubeSamples(
+    const std::vector<SweepParameter>& parameters, int count,
+    unsigned seed) {
+  std::vector<std::vector<float>> samples(std::max(count, 0));
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> jitter(0.0f, 1.0f);
+
+  // 每个参数的取值范围均分为 count 段，每段恰好采样一次，段的顺序随机
+  std::vector<int> strata(samples.size());
+  for (const SweepParameter& parameter : parameters) {
+    std::iota(strata.begin(), strata.end(), 0);
+    std::shuffle(strata.begin(), strata.end(), rng);
+    for (size_t i = 0; i < samples.size(); ++i) {
+      float t = (strata[i] + jitter(rng)) / samples.size();
+      samples[i].push_back(parameter.min +
+                           (parameter.max - parameter.min) * t);
+    }
+  }
+  return samples;
+}
+
+std::vector<std::vector<float>> BalanceSweep::makeSamples(
+    const SweepSpec& spec) {
+  if (spec.method == "lhs") {
+    return latinHypercubeSamples(spec.parameters, spec.samples, spec.seed);
+  }
+  return gridSamples(spec.parameters);
+}
+
+bool BalanceSweep::applyValues(const std::vector<SweepParameter>& parameters,
+                               const std::vector<float>& values,
+                               SimConfig& config) {
+  if (values.size() != parameters.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < parameters.size(); ++i) {
+    const SweepParameter& parameter = parameters[i];
+    bool applied = false;
+    if (parameter.config == "soldier") {
+      applied = config.setSoldierValue(parameter.name, parameter.level,
+                                       parameter.field, values[i]);
+    } else if (parameter.config == "building") {
+      applied = config.setBuildingValue(parameter.name, parameter.level,
+                                        parameter.field, values[i]);
+    }
+    if (!applied) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::vector<SweepSample> BalanceSweep::run(
+    const SimConfig& baseConfig,
+    const std::vector<SweepParameter>& parameters,
+    const std::vector<std::vector<float>>& samples,
+    const std::vector<SweepBattle>& battles, const SimThreadPool& pool) {
+  const int battleCount = static_cast<int>(battles.size());
+  std::vector<BattleOutcome> outcomes(samples.size() * battles.size());
+
+  // 每个任务复制一份配置，配置很小，复制的开销远小于一场战斗
+  pool.parallelFor(static_cast<int>(outcomes.size()), [&](int index) {
+    int sampleIndex = index / battleCount;
+    int battleIndex = index % battleCount;
+    SimConfig config = baseConfig;
+    if (!applyValues(parameters, samples[sampleIndex], config)) {
+      return;
+    }
+
+    BattleSimulator simulator(config);
+    const SweepBattle& battle = battles[battleIndex];
+    SimReport report = simulator.run(battle.layout, battle.record);
+    BattleOutcome& outcome = outcomes[index];
+    outcome.valid = true;
+    outcome.win = report.result.win;
+    outcome.stars = report.result.stars;
+    outcome.ratio = report.result.ratio;
+  });
+
+  std::vector<SweepSample> results(samples.size());
+  for (size_t i = 0; i < samples.size(); ++i) {
+    SweepSample& result = results[i];
+    result.values = samples[i];
+    for (int j = 0; j < battleCount; ++j) {
+      const BattleOutcome& outcome = outcomes[i * battleCount + j];
+      if (!outcome.valid) {
+        continue;
+      }
+      result.battles++;
+      result.wins += outcome.win ? 1 : 0;
+      result.stars += outcome.stars;
+      result.ratio += outcome.ratio;
+    }
+    if (result.battles > 0) {
+      result.stars /= result.battles;
+      result.ratio /= result.battles;
+    }
+  }
+  return results;
+}
+
+std::string BalanceSweep::toCsv(const std::vector<SweepParameter>& parameters,
+                                const std::vector<SweepSample>& results) {
+  std::ostringstream out;
+  for (const SweepParameter& parameter : parameters) {
+    out << parameter.label() << ",";
+  }
+  out << "battles,wins,winRate,avgStars,avgRatio\n";
+
+  for (const SweepSample& result : results) {
+    for (float value : result.values) {
+      out << value << ",";
+    }
+    float winRate =
+        result.battles > 0 ? static_cast<float>(result.wins) / result.battles
+                           : 0.0f;
+    out << result.battles << "," << result.wins << "," << winRate << ","
+        << result.stars << "," << result.ratio << "\n";
+  }
+  return out.str();
+}
+
+std::string BalanceSweep::toJson(const std::vector<SweepParameter>& parameters,
+                                 const std::vector<SweepSample>& results) {
+  Json::Value output(Json::arrayValue);
+  for (const SweepSample& result : results) {
+    Json::Value item(Json::objectValue);
+    Json::Value values(Json::objectValue);
+    for (size_t i = 0; i < parameters.size(); ++i) {
+      values[parameters[i].label()] = result.values[i];
+    }
+    item["parameters"] = values;
+    item["battles"] = result.battles;
+    item["wins"] = result.wins;
+    item["winRate"] =
+        result.battles > 0 ? static_cast<float>(result.wins) / result.battles
+                           : 0.0f;
+    item["avgStars"] = result.stars;
+    item["avgRatio"] = result.ratio;
+    output.append(item);
+  }
+  return SimJson::write(output, true);
+}
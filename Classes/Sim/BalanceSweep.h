@@ -0,0 +1,112 @@
+#ifndef __BALANCE_SWEEP_H__
+#define __BALANCE_SWEEP_H__
+
+#include <string>
+#include <vector>
+
+#include "Sim/SimConfig.h"
+#include "Sim/SimScenario.h"
+
+class SimThreadPool;
+
+/**
+ * 参与扫描的一个配置字段
+ */
+struct SweepParameter {
+  std::string config;  // "soldier"（soilder.json）或 "building"
+  std::string name;    // 兵种键或建筑名称，如 "barbarian", "Cannon"
+  int level = 0;       // 等级，<= 0 表示全部等级
+  std::string field;   // 配置文件中的字段名，如 "Attack", "damage"
+  float min = 0.0f;
+  float max = 0.0f;
+  int steps = 2;  // 网格扫描时的取值个数（包含两端）
+
+  /**
+   * 结果表中的列名，如 "soldier.barbarian.1.Attack"
+   */
+  std::string label() const;
+};
+
+/**
+ * 扫描方案
+ */
+struct SweepSpec {
+  std::string method = "grid";  // "grid" 或 "lhs"（拉丁超立方）
+  int samples = 100;            // 拉丁超立方的采样数
+  unsigned seed = 1;
+  std::vector<SweepParameter> parameters;
+};
+
+/**
+ * 一场参与扫描的战斗
+ */
+struct SweepBattle {
+  std::vector<SimBuildingPlacement> layout;
+  SimRecord record;
+};
+
+/**
+ * 一组参数取值的统计结果
+ */
+struct SweepSample {
+  std::vector<float> values;  // 与 SweepSpec::parameters 一一对应
+  int battles = 0;
+  int wins = 0;
+  float stars = 0.0f;  // 平均星数
+  float ratio = 0.0f;  // 平均摧毁比例
+};
+
+/**
+ * 数值平衡扫描
+ * 在参数空间中按网格或拉丁超立方采样，每个采样点复制一份配置并在内存中
+ * 覆盖对应字段，对全部战斗进行无头模拟，统计胜率、平均星数和摧毁比例。
+ * 采样点与战斗的组合作为独立任务分配到线程池
+ */
+class BalanceSweep {
+ public:
+  /**
+   * 读取扫描方案
+   * 格式：{"method": "grid", "samples": 100, "seed": 1, "parameters": [
+   *   {"config": "soldier", "name": "barbarian", "level": 1,
+   *    "field": "Attack", "min": 10, "max": 40, "steps": 4}]}
+   */
+  static bool loadSpec(const std::string& path, SweepSpec& spec);
+  static bool parseSpec(const std::string& text, SweepSpec& spec);
+
+  /**
+   * 生成采样点
+   */
+  static std::vector<std::vector<float>> gridSamples(
+      const std::vector<SweepParameter>& parameters);
+  static std::vector<std::vector<float>> latinHypercubeSamples(
+      const std::vector<SweepParameter>& parameters, int count,
+      unsigned seed);
+  static std::vector<std::vector<float>> makeSamples(const SweepSpec& spec);
+
+  /**
+   * 将一组参数取值写入配置
+   * @return 任一字段不存在时返回 false
+   */
+  static bool applyValues(const std::vector<SweepParameter>& parameters,
+                          const std::vector<float>& values,
+                          SimConfig& config);
+
+  /**
+   * 对每个采样点模拟全部战斗
+   */
+  static std::vector<SweepSample> run(
+      const SimConfig& baseConfig,
+      const std::vector<SweepParameter>& parameters,
+      const std::vector<std::vector<float>>& samples,
+      const std::vector<SweepBattle>& battles, const SimThreadPool& pool);
+
+  /**
+   * 输出结果表
+   */
+  static std::string toCsv(const std::vector<SweepParameter>& parameters,
+                           const std::vector<SweepSample>& results);
+  static std::string toJson(const std::vector<SweepParameter>& parameters,
+                            const std::vector<SweepSample>& results);
+};
+
+#endif  // __BALANCE_SWEEP_H__
@@ -0,0 +1,111 @@
+#include "Sim/BattleSimulator.h"
+
+#include "Battle/BattleWorld.h"
+
+namespace {
+bool hasActiveSpells(const BattleWorld& world) {
+  for (const BattleSpell& spell : world.getSpells()) {
+    if (spell.active) {
+      return true;
+    }
+  }
+  return false;
+}
+}  // namespace
+
+BattleSimulator::BattleSimulator(const SimConfig& config, int tickRate)
+    : _config(config),
+      _tickRate(tickRate > 0 ? tickRate : BattleClock::DEFAULT_TICK_RATE) {}
+
+SimReport BattleSimulator::run(const std::vector<SimBuildingPlacement>& layout,
+                               const SimRecord& record) const {
+  BattleWorld world(_config.getProjection());
+  // 与 BattleManager 相同的异步寻路预算；多场战斗已经并行，
+  // 寻路就在帧末直接计算，结果与线程数无关
+  world.enableAsyncPathfinding(0, BattlePathService::DEFAULT_BUDGET);
+  SimReport report;
+
+  std::vector<float> initialHP;
+  for (const SimBuildingPlacement& placement : layout) {
+    BattleBuildingStats stats;
+    if (!_config.getBuildingStats(placement.name, placement.level, stats)) {
+      continue;
+    }
+    int id = world.addBuilding(placement.name, placement.level, stats,
+                               placement.row, placement.col, placement.hp);
+    initialHP.push_back(static_cast<float>(world.getBuildings()[id].hp));
+  }
+
+  // 与 BattleManager 相同，每个逻辑帧推进一个固定步长
+  const float tickDelta = 1.0f / _tickRate;
+  const int maxTicks = record.duration * _tickRate;
+  size_t next = 0;
+  int tick = 0;
+  while (tick < maxTicks) {
+    while (next < record.placements.size() &&
+           record.placements[next].tick <= tick) {
+      if (deploy(world, record.placements[next])) {
+        report.deployed++;
+      }
+      next++;
+    }
+
+    world.update(tickDelta);
+    tick++;
+
+    BattleResult result;
+    if (world.getResult(result) && result.ratio >= 1.0f) {
+      break;
+    }
+    if (next >= record.placements.size() && !world.hasLivingSoldiers() &&
+        !hasActiveSpells(world)) {
+      break;
+    }
+  }
+
+  world.getResult(report.result);
+  report.ticks = tick;
+  report.duration = tick * tickDelta;
+
+  const std::vector<BattleBuilding>& buildings = world.getBuildings();
+  report.buildings.reserve(buildings.size());
+  for (size_t i = 0; i < buildings.size(); ++i) {
+    const BattleBuilding& building = buildings[i];
+    SimBuildingReport buildingReport;
+    buildingReport.name = building.name;
+    buildingReport.level = building.level;
+    buildingReport.maxHP = static_cast<float>(building.maxHP);
+    buildingReport.damage = initialHP[i] - static_cast<float>(building.hp);
+    buildingReport.destroyed = !building.isAlive();
+    report.buildings.push_back(buildingReport);
+  }
+  return report;
+}
+
+bool BattleSimulator::deploy(BattleWorld& world,
+                             const SimPlacement& placement) const {
+  BattleVec2 position(placement.x, placement.y);
+
+  if (placement.type == "troop") {
+    SoldierType type;
+    BattleSoldierStats stats;
+    if (!BattleTypeUtils::parseSoldierType(placement.category, type) ||
+        !_config.getSoldierStats(type, placement.level, stats)) {
+      return false;
+    }
+    world.addSoldier(type, placement.level, stats, position);
+    return true;
+  }
+
+  if (placement.type == "spell") {
+    SpellType type;
+    BattleSpellStats stats;
+    if (!BattleTypeUtils::parseSpellType(placement.category, type) ||
+        !_config.getSpellStats(type, stats)) {
+      return false;
+    }
+    world.castSpell(type, stats, position);
+    return true;
+  }
+  return false;
+}
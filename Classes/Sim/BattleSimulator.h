@@ -0,0 +1,69 @@
+#ifndef __BATTLE_SIMULATOR_H__
+#define __BATTLE_SIMULATOR_H__
+
+#include <string>
+#include <vector>
+
+#include "Battle/BattleClock.h"
+#include "Battle/BattleEntities.h"
+#include "Sim/SimConfig.h"
+#include "Sim/SimScenario.h"
+
+class BattleWorld;
+
+/**
+ * 单个建筑的战斗结果
+ */
+struct SimBuildingReport {
+  std::string name;
+  int level = 1;
+  float maxHP = 0.0f;
+  float damage = 0.0f;  // 本场战斗受到的伤害
+  bool destroyed = false;
+};
+
+/**
+ * 一场无头战斗的结果
+ */
+struct SimReport {
+  BattleResult result;
+  int ticks = 0;          // 模拟的逻辑帧数
+  float duration = 0.0f;  // 战斗时长（秒）
+  int deployed = 0;       // 成功部署的记录数
+  std::vector<SimBuildingReport> buildings;
+};
+
+/**
+ * 无头战斗模拟器
+ * 按 RecordScene 的回放规则驱动 BattleWorld：
+ * 每个逻辑帧先部署该帧的记录，再推进一步。
+ * 以下任一条件满足时结束：达到记录时长、非城墙建筑全部摧毁、
+ * 全部记录已部署且场上没有存活的士兵和生效中的法术。
+ * 模拟器本身只读，可以在多个线程中同时使用
+ */
+class BattleSimulator {
+ public:
+  /**
+   * 构造函数
+   * @param config 游戏配置，需在模拟器的生命周期内保持有效
+   * @param tickRate 逻辑帧率
+   */
+  explicit BattleSimulator(const SimConfig& config,
+                           int tickRate = BattleClock::DEFAULT_TICK_RATE);
+
+  /**
+   * 模拟一场战斗
+   */
+  SimReport run(const std::vector<SimBuildingPlacement>& layout,
+                const SimRecord& record) const;
+
+  int getTickRate() const { return _tickRate; }
+
+ private:
+  bool deploy(BattleWorld& world, const SimPlacement& placement) const;
+
+  const SimConfig& _config;
+  int _tickRate;
+};
+
+#endif  // __BATTLE_SIMULATOR_H__
@@ -0,0 +1,135 @@
+/**
+ * coc_optimize：针对基地布局搜索进攻方案
+ *
+ * 用法：
+ *   coc_optimize [--resources DIR] [--army FILE] [--threads N]
+ *                [--p00 X,Y] [--restarts N] [--population N]
+ *                [--generations N] [--window SEC] [--seed N]
+ *                [--output FILE] MAP
+ *
+ * 军队默认读取 DIR/config/troop.json。最优方案以进攻记录格式写入
+ * --output（可由 RecordScene 回放），未指定时输出到标准输出；
+ * 评分摘要输出到标准错误
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Sim/AttackOptimizer.h"
+#include "Sim/BattleSimulator.h"
+#include "Sim/SimConfig.h"
+#include "Sim/SimScenario.h"
+#include "Sim/SimThreadPool.h"
+
+namespace {
+void printUsage() {
+  std::cerr << "usage: coc_optimize [--resources DIR] [--army FILE]"
+               " [--threads N] [--p00 X,Y] [--restarts N]"
+               " [--population N] [--generations N] [--window SEC]"
+               " [--seed N] [--output FILE] MAP"
+            << std::endl;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::string resourceDir = "Resources";
+  std::string armyPath;
+  std::string outputPath;
+  std::string mapPath;
+  int threadCount = 0;
+  bool hasP00 = false;
+  BattleVec2 p00;
+  AttackOptimizerOptions options;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (arg == "--resources" && hasValue) {
+      resourceDir = argv[++i];
+    } else if (arg == "--army" && hasValue) {
+      armyPath = argv[++i];
+    } else if (arg == "--output" && hasValue) {
+      outputPath = argv[++i];
+    } else if (arg == "--threads" && hasValue) {
+      threadCount = std::atoi(argv[++i]);
+    } else if (arg == "--restarts" && hasValue) {
+      options.restarts = std::atoi(argv[++i]);
+    } else if (arg == "--population" && hasValue) {
+      options.population = std::atoi(argv[++i]);
+    } else if (arg == "--generations" && hasValue) {
+      options.generations = std::atoi(argv[++i]);
+    } else if (arg == "--window" && hasValue) {
+      options.deployWindow = static_cast<float>(std::atof(argv[++i]));
+    } else if (arg == "--seed" && hasValue) {
+      options.seed =
+          static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+    } else if (arg == "--p00" && hasValue) {
+      float x = 0.0f;
+      float y = 0.0f;
+      if (std::sscanf(argv[++i], "%f,%f", &x, &y) != 2) {
+        printUsage();
+        return 1;
+      }
+      p00 = BattleVec2(x, y);
+      hasP00 = true;
+    } else if (arg == "-h" || arg == "--help") {
+      printUsage();
+      return 0;
+    } else if (!arg.empty() && arg[0] != '-' && mapPath.empty()) {
+      mapPath = arg;
+    } else {
+      printUsage();
+      return 1;
+    }
+  }
+
+  if (mapPath.empty()) {
+    printUsage();
+    return 1;
+  }
+  if (armyPath.empty()) {
+    armyPath = resourceDir + "/config/troop.json";
+  }
+
+  SimConfig config;
+  if (!config.loadFromDirectory(resourceDir)) {
+    std::cerr << "coc_optimize: failed to load config from " << resourceDir
+              << std::endl;
+    return 1;
+  }
+  if (hasP00) {
+    config.setP00(p00);
+  }
+
+  std::vector<SimBuildingPlacement> layout;
+  if (!SimScenario::loadLayout(mapPath, layout)) {
+    std::cerr << "coc_optimize: failed to load map " << mapPath << std::endl;
+    return 1;
+  }
+  SimArmy army;
+  if (!SimScenario::loadArmy(armyPath, army)) {
+    std::cerr << "coc_optimize: failed to load army " << armyPath
+              << std::endl;
+    return 1;
+  }
+
+  BattleSimulator simulator(config);
+  AttackOptimizer optimizer(simulator, config.getProjection(), army, options);
+  SimThreadPool pool(threadCount);
+  AttackPlanResult result = optimizer.optimize(layout, pool);
+
+  std::cerr << "stars " << result.report.result.stars << ", ratio "
+            << result.report.result.ratio << ", duration "
+            << result.report.duration << "s, score " << result.score << ", "
+            << result.evaluations << " battles" << std::endl;
+
+  if (outputPath.empty()) {
+    std::cout << SimScenario::writeRecord(result.record) << std::endl;
+  } else if (!SimScenario::saveRecord(outputPath, result.record)) {
+    std::cerr << "coc_optimize: failed to write " << outputPath << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,686 @@
+/**
+ * coc_pathbench：寻路算法性能对比
+ *
+ * 用法：
+ *   coc_pathbench [--resources DIR] [--precision N[,N]...] [--queries N]
+ *                 [--p00 X,Y] [--no-synthetic] [--json FILE]
+ *                 [--baseline FILE] [MAP]...
+ *
+ * 在每个基地布局上生成同一组寻路请求（从地图边缘出发，以随机建筑为
+ * 目标，与士兵寻路相同），分别用 A* 和 JPS 求解，输出成功率、平均
+ * 展开节点数、单次寻路耗时的 p50 / p99、平均内存分配次数和平均路径
+ * 长度（网格）。
+ * 同一组请求还测量战斗中士兵实际使用的寻路：流场的构建（flow_build，
+ * 每个目标建筑一次）、另一座建筑被摧毁后的局部修复（flow_repair）、
+ * 沿流场生成路径（flow_trace），以及允许破墙的加权搜索（breach）。
+ * 未指定 MAP 时使用 Resources/level 下的 1.json ~ 3.json；另外附带
+ * 三个合成布局：open（空旷地面上的零散建筑）、rings（开口交错的
+ * 多层城墙）和 maze（城墙迷宫）。默认精度为 2、4、8。
+ * --json 把结果写入文件，--baseline 读取之前写入的文件并逐项列出变化，
+ * 用于在修改寻路之后与保存的基线对比。Classes/Sim/pathbench_baseline.json
+ * 为 Release 构建在默认参数下的结果
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Battle/BattleFlowField.h"
+#include "Battle/BattleGoalSet.h"
+#include "Battle/BattlePathFinder.h"
+#include "Battle/BattleWorld.h"
+#include "Sim/SimConfig.h"
+#include "Sim/SimJson.h"
+#include "Sim/SimScenario.h"
+
+namespace {
+// 计入寻路的内存分配次数，只在测量期间打开
+std::atomic<bool> gCountAllocations(false);
+std::atomic<long long> gAllocations(0);
+}  // namespace
+
+void* operator new(std::size_t size) {
+  if (gCountAllocations.load(std::memory_order_relaxed)) {
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+  }
+  void* memory = std::malloc(size == 0 ? 1 : size);
+  if (!memory) {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+
+void operator delete(void* memory, std::size_t) noexcept {
+  std::free(memory);
+}
+
+namespace {
+// 同一组请求在不同算法间复用，固定随机种子保证多次运行可比
+const unsigned kSeed = 20240101;
+// 流场攻击位使用的攻击范围（像素），与近战士兵相同
+const float kAttackRange = 40.0f;
+// 破墙搜索中拆掉一段墙折算的代价：直线走 4 个网格
+const int kWallPenaltyGrids = 4;
+
+struct PathQuery {
+  BattleVec2 start;
+  BattleVec2 target;
+  int building = -1;  // 目标建筑在 BattleWorld 中的下标
+};
+
+struct BenchMap {
+  std::string path;  // 布局文件，合成布局为名称
+  BattleWorld world;
+  BattleGrid walls;  // 破墙搜索的墙壁网格
+  std::vector<PathQuery> queries;
+
+  BenchMap(const std::string& mapPath, const BattleProjection& projection)
+      : path(mapPath), world(projection), walls(projection.gridSize) {}
+};
+
+struct BenchResult {
+  int queries = 0;
+  int found = 0;
+  long long expanded = 0;
+  long long allocations = 0;
+  double length = 0.0;  // 网格
+  double p50 = 0.0;     // 单次寻路耗时（微秒）
+  double p99 = 0.0;
+};
+
+void printUsage() {
+  std::cerr << "usage: coc_pathbench [--resources DIR] [--precision N[,N]...]"
+               " [--queries N] [--p00 X,Y] [--no-synthetic] [--json FILE]"
+               " [--baseline FILE] [MAP]..."
+            << std::endl;
+}
+
+bool parsePrecisions(const std::string& text, std::vector<int>& precisions) {
+  precisions.clear();
+  std::stringstream stream(text);
+  std::string item;
+  while (std::getline(stream, item, ',')) {
+    int precision = std::atoi(item.c_str());
+    if (precision <= 0) {
+      return false;
+    }
+    precisions.push_back(precision);
+  }
+  return !precisions.empty();
+}
+
+/**
+ * 生成寻路请求：起点为地图边缘一圈的可通行网格，目标为非城墙建筑
+ */
+std::vector<PathQuery> makeQueries(const BattleWorld& world, int count,
+                                   std::mt19937& random) {
+  const BattleGrid& grid = world.getGrid();
+  const BattleProjection& projection = world.getProjection();
+  std::vector<BattleVec2> starts;
+  const int size = grid.getSize();
+  for (int i = 0; i < size; ++i) {
+    const int cells[4][2] = {
+        {0, i}, {size - 1, i}, {i, 0}, {i, size - 1}};
+    for (const auto& cell : cells) {
+      if (grid.isWalkable(cell[0], cell[1])) {
+        starts.push_back(
+            projection.gridToScene(cell[0] + 0.5f, cell[1] + 0.5f));
+      }
+    }
+  }
+  std::vector<int> targets;
+  for (const BattleBuilding& building : world.getBuildings()) {
+    if (building.type != BuildingType::WALL) {
+      targets.push_back(building.id);
+    }
+  }
+
+  std::vector<PathQuery> queries;
+  if (starts.empty() || targets.empty()) {
+    return queries;
+  }
+  std::uniform_int_distribution<size_t> pickStart(0, starts.size() - 1);
+  std::uniform_int_distribution<size_t> pickTarget(0, targets.size() - 1);
+  for (int i = 0; i < count; ++i) {
+    PathQuery query;
+    query.start = starts[pickStart(random)];
+    query.building = targets[pickTarget(random)];
+    query.target = world.getBuildings()[query.building].position;
+    queries.push_back(query);
+  }
+  return queries;
+}
+
+// ================= 合成布局 =================
+
+BattleBuildingStats syntheticStats(BuildingType type, int gridCount) {
+  BattleBuildingStats stats;
+  stats.type = type;
+  stats.gridCount = gridCount;
+  stats.maxHP = 1000.0f;
+  return stats;
+}
+
+void addWall(BattleWorld& world, int row, int col) {
+  static const BattleBuildingStats wall = syntheticStats(BuildingType::WALL, 1);
+  world.addBuilding("Wall", 1, wall, row, col);
+}
+
+void addTarget(BattleWorld& world, int row, int col) {
+  static const BattleBuildingStats mine =
+      syntheticStats(BuildingType::RESOURCE, 3);
+  world.addBuilding("GoldMine", 1, mine, row, col);
+}
+
+/**
+ * 空旷地面：散布在地图上的建筑，没有城墙
+ */
+void buildOpenField(BattleWorld& world) {
+  const int size = world.getGrid().getSize();
+  for (int row = size / 5; row < size - 2; row += size / 5) {
+    for (int col = size / 5; col < size - 2; col += size / 5) {
+      addTarget(world, row, col);
+    }
+  }
+}
+
+/**
+ * 多层城墙：中心建筑外围三圈城墙，每圈只有一个开口且方向交错，
+ * 到达中心需要绕行
+ */
+void buildWalledRings(BattleWorld& world) {
+  const int size = world.getGrid().getSize();
+  const int center = size / 2;
+  addTarget(world, center, center);
+  int side = 0;
+  for (int radius = 4; radius < center - 1; radius += 4, ++side) {
+    for (int i = -radius; i <= radius; ++i) {
+      // 开口依次位于上、右、下、左边的中点
+      const int cells[4][2] = {{center - radius, center + i},
+                               {center + i, center + radius},
+                               {center + radius, center - i},
+                               {center - i, center - radius}};
+      for (int edge = 0; edge < 4; ++edge) {
+        if (edge == side % 4 && (i == 0 || i == 1)) {
+          continue;
+        }
+        addWall(world, cells[edge][0], cells[edge][1]);
+      }
+    }
+  }
+}
+
+/**
+ * 城墙迷宫：偶数坐标为通道，奇数坐标为墙，随机深度优先生成；
+ * 中心清出一块空地放置建筑，四边各开一个入口
+ */
+void buildMaze(BattleWorld& world, std::mt19937& random) {
+  const int size = world.getGrid().getSize();
+  const int cells = (size - 4) / 2;  // 每边的通道数
+  const int last = cells * 2 + 1;    // 迷宫最外圈的墙
+  if (cells < 2) {
+    return;
+  }
+  std::vector<unsigned char> open((last + 1) * (last + 1), 0);
+  auto at = [&](int r, int c) -> unsigned char& {
+    return open[r * (last + 1) + c];
+  };
+
+  std::vector<std::pair<int, int>> stack;
+  stack.emplace_back(0, 0);
+  at(2, 2) = 1;
+  const int dr[] = {0, 1, 0, -1};
+  const int dc[] = {1, 0, -1, 0};
+  while (!stack.empty()) {
+    int r = stack.back().first;
+    int c = stack.back().second;
+    int choices[4];
+    int count = 0;
+    for (int d = 0; d < 4; ++d) {
+      int nr = r + dr[d];
+      int nc = c + dc[d];
+      if (nr >= 0 && nr < cells && nc >= 0 && nc < cells &&
+          !at(nr * 2 + 2, nc * 2 + 2)) {
+        choices[count++] = d;
+      }
+    }
+    if (count == 0) {
+      stack.pop_back();
+      continue;
+    }
+    int d = choices[std::uniform_int_distribution<int>(0, count - 1)(random)];
+    at(r * 2 + 2 + dr[d], c * 2 + 2 + dc[d]) = 1;
+    at((r + dr[d]) * 2 + 2, (c + dc[d]) * 2 + 2) = 1;
+    stack.emplace_back(r + dr[d], c + dc[d]);
+  }
+
+  const int center = size / 2;
+  for (int r = center - 2; r <= center + 2; ++r) {
+    for (int c = center - 2; c <= center + 2; ++c) {
+      at(r, c) = 1;
+    }
+  }
+  at(1, 2) = 1;
+  at(last, last - 1) = 1;
+  at(2, 1) = 1;
+  at(last - 1, last) = 1;
+
+  for (int r = 1; r <= last; ++r) {
+    for (int c = 1; c <= last; ++c) {
+      if (!at(r, c)) {
+        addWall(world, r, c);
+      }
+    }
+  }
+  addTarget(world, center, center);
+}
+
+// ================= 测量 =================
+
+double percentile(std::vector<double>& samples, double ratio) {
+  if (samples.empty()) {
+    return 0.0;
+  }
+  size_t index = static_cast<size_t>(ratio * (samples.size() - 1) + 0.5);
+  std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+  return samples[index];
+}
+
+/**
+ * 测量一次调用，记录耗时（微秒）和内存分配次数
+ */
+template <typename Func>
+void measure(BenchResult& result, std::vector<double>& latencies,
+             Func&& func) {
+  long long allocations = gAllocations.load();
+  gCountAllocations.store(true);
+  auto begin = std::chrono::steady_clock::now();
+  func();
+  auto end = std::chrono::steady_clock::now();
+  gCountAllocations.store(false);
+  result.allocations += gAllocations.load() - allocations;
+  latencies.push_back(
+      std::chrono::duration<double, std::micro>(end - begin).count());
+  result.queries++;
+}
+
+void addPath(BenchResult& result, const BattleVec2& start,
+             const std::vector<BattleVec2>& path) {
+  if (path.empty()) {
+    return;
+  }
+  result.found++;
+  BattleVec2 previous = start;
+  for (const BattleVec2& point : path) {
+    result.length += static_cast<float>(previous.distance(point));
+    previous = point;
+  }
+}
+
+void finish(BenchResult& result, std::vector<double>& latencies,
+            const BattleProjection& projection) {
+  result.length /= static_cast<float>(projection.gridPixelLength());
+  result.p50 = percentile(latencies, 0.50);
+  result.p99 = percentile(latencies, 0.99);
+}
+
+BenchResult runQueries(BenchMap& map, int precision) {
+  const BattleProjection& projection = map.world.getProjection();
+  const BattleGrid& grid = map.world.getGrid();
+  BenchResult result;
+  std::vector<double> latencies;
+  latencies.reserve(map.queries.size());
+  for (const PathQuery& query : map.queries) {
+    std::vector<BattleVec2> path;
+    measure(result, latencies, [&] {
+      path = BattlePathFinder::findPath(query.start, query.target,
+                                        projection, grid, precision);
+    });
+    result.expanded += BattlePathFinder::getLastExpandedCount();
+    addPath(result, query.start, path);
+  }
+  finish(result, latencies, projection);
+  return result;
+}
+
+/**
+ * 流场的三项测量，每个目标建筑构建一次流场：
+ * build 为构建耗时；trace 为以它为目标的每个请求沿流场生成路径的耗时；
+ * repair 为列表中下一座建筑被摧毁后局部修复的耗时。
+ * 展开节点数为构建或修复访问的子网格数，trace 不统计
+ */
+struct FlowResults {
+  BenchResult build;
+  BenchResult repair;
+  BenchResult trace;
+};
+
+FlowResults runFlowFields(BenchMap& map, int precision) {
+  const BattleProjection& projection = map.world.getProjection();
+  const BattleGrid& grid = map.world.getGrid();
+  const std::vector<BattleBuilding>& buildings = map.world.getBuildings();
+  FlowResults results;
+  std::vector<double> buildLatencies;
+  std::vector<double> repairLatencies;
+  std::vector<double> traceLatencies;
+  std::vector<bool> done(buildings.size(), false);
+  BattleGoalSet goals;
+  BattleFlowField field;
+  for (const PathQuery& query : map.queries) {
+    if (done[query.building]) {
+      continue;
+    }
+    done[query.building] = true;
+    const BattleBuilding& target = buildings[query.building];
+    goals.build(target.row, target.col, target.gridCount,
+                BattleReal(kAttackRange), projection, grid, precision);
+
+    bool built = false;
+    measure(results.build, buildLatencies,
+            [&] { built = field.build(goals, grid); });
+    results.build.expanded += field.getLastVisitedCount();
+    results.build.found += built ? 1 : 0;
+
+    for (const PathQuery& other : map.queries) {
+      if (other.building != query.building) {
+        continue;
+      }
+      std::vector<BattleVec2> path;
+      measure(results.trace, traceLatencies,
+              [&] { path = field.tracePath(other.start, projection); });
+      addPath(results.trace, other.start, path);
+    }
+
+    const BattleBuilding& destroyed =
+        buildings[(query.building + 1) % buildings.size()];
+    if (destroyed.id == target.id) {
+      continue;
+    }
+    BattleGrid changed = grid;
+    int row = static_cast<int>(destroyed.row);
+    int col = static_cast<int>(destroyed.col);
+    changed.setArea(row, col, destroyed.gridCount, false);
+    std::vector<BattleGridArea> areas(
+        1, BattleGridArea::around(row, col, destroyed.gridCount));
+    bool repaired = false;
+    measure(results.repair, repairLatencies,
+            [&] { repaired = field.repair(changed, areas, goals); });
+    results.repair.expanded += field.getLastVisitedCount();
+    results.repair.found += repaired ? 1 : 0;
+  }
+  finish(results.build, buildLatencies, projection);
+  finish(results.repair, repairLatencies, projection);
+  finish(results.trace, traceLatencies, projection);
+  return results;
+}
+
+BenchResult runBreach(BenchMap& map, int precision) {
+  const BattleProjection& projection = map.world.getProjection();
+  const BattleGrid& grid = map.world.getGrid();
+  const int size = grid.getSize();
+  std::vector<int> penalty(size * size, 0);
+  for (int row = 0; row < size; ++row) {
+    for (int col = 0; col < size; ++col) {
+      if (!map.walls.isWalkable(row, col)) {
+        penalty[row * size + col] = kWallPenaltyGrids * precision * 10;
+      }
+    }
+  }
+
+  BenchResult result;
+  std::vector<double> latencies;
+  latencies.reserve(map.queries.size());
+  for (const PathQuery& query : map.queries) {
+    std::vector<BattleVec2> path;
+    int firstWall = -1;
+    measure(result, latencies, [&] {
+      path = BattlePathFinder::findBreachPath(query.start, query.target,
+                                              projection, grid, map.walls,
+                                              penalty, precision, firstWall);
+    });
+    result.expanded += BattlePathFinder::getLastExpandedCount();
+    addPath(result, query.start, path);
+  }
+  finish(result, latencies, projection);
+  return result;
+}
+
+Json::Value toJson(const std::string& map, int precision,
+                   const std::string& algo, const BenchResult& result) {
+  double queries = result.queries > 0 ? result.queries : 1;
+  double found = result.found > 0 ? result.found : 1;
+  Json::Value value(Json::objectValue);
+  value["map"] = map;
+  value["precision"] = precision;
+  value["algo"] = algo;
+  value["queries"] = result.queries;
+  value["success"] = result.found / queries;
+  value["expanded"] = result.expanded / queries;
+  value["p50_us"] = result.p50;
+  value["p99_us"] = result.p99;
+  value["allocs"] = result.allocations / queries;
+  value["length"] = result.length / found;
+  return value;
+}
+
+void printResult(const Json::Value& row) {
+  std::printf("  %-11s %7d %8.1f%% %10.1f %9.2f %9.2f %8.2f %8.2f\n",
+              row["algo"].asCString(), row["queries"].asInt(),
+              row["success"].asDouble() * 100.0, row["expanded"].asDouble(),
+              row["p50_us"].asDouble(), row["p99_us"].asDouble(),
+              row["allocs"].asDouble(), row["length"].asDouble());
+}
+
+/**
+ * 与基线中相同（布局, 精度, 算法）的记录对比，列出各项的相对变化
+ */
+void printComparison(const Json::Value& baseline, const Json::Value& rows) {
+  // 成功率按百分点比较，其余按相对变化比较
+  std::printf("\ncompared with baseline (success in points, others in %%)\n");
+  std::printf("  %-24s %4s %-11s %9s %10s %9s %9s %8s\n", "map", "prec",
+              "algo", "success", "expanded", "p50", "p99", "allocs");
+  auto change = [](double before, double after) {
+    return before != 0.0 ? (after - before) / before * 100.0 : 0.0;
+  };
+  for (const Json::Value& row : rows) {
+    const Json::Value* match = nullptr;
+    for (const Json::Value& old : baseline) {
+      if (old["map"] == row["map"] && old["precision"] == row["precision"] &&
+          old["algo"] == row["algo"]) {
+        match = &old;
+        break;
+      }
+    }
+    if (!match) {
+      continue;
+    }
+    const Json::Value& old = *match;
+    std::printf("  %-24s %4d %-11s %+9.1f %+9.1f%% %+8.1f%% %+8.1f%% "
+                "%+7.1f%%\n",
+                row["map"].asCString(), row["precision"].asInt(),
+                row["algo"].asCString(),
+                (row["success"].asDouble() - old["success"].asDouble()) * 100.0,
+                change(old["expanded"].asDouble(), row["expanded"].asDouble()),
+                change(old["p50_us"].asDouble(), row["p50_us"].asDouble()),
+                change(old["p99_us"].asDouble(), row["p99_us"].asDouble()),
+                change(old["allocs"].asDouble(), row["allocs"].asDouble()));
+  }
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::string resourceDir = "Resources";
+  std::vector<int> precisions = {2, 4, 8};
+  int queryCount = 500;
+  bool hasP00 = false;
+  bool synthetic = true;
+  BattleVec2 p00;
+  std::string jsonPath;
+  std::string baselinePath;
+  std::vector<std::string> mapPaths;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (arg == "--resources" && hasValue) {
+      resourceDir = argv[++i];
+    } else if (arg == "--precision" && hasValue) {
+      if (!parsePrecisions(argv[++i], precisions)) {
+        printUsage();
+        return 1;
+      }
+    } else if (arg == "--queries" && hasValue) {
+      queryCount = std::atoi(argv[++i]);
+    } else if (arg == "--p00" && hasValue) {
+      float x = 0.0f;
+      float y = 0.0f;
+      if (std::sscanf(argv[++i], "%f,%f", &x, &y) != 2) {
+        printUsage();
+        return 1;
+      }
+      p00 = BattleVec2(x, y);
+      hasP00 = true;
+    } else if (arg == "--no-synthetic") {
+      synthetic = false;
+    } else if (arg == "--json" && hasValue) {
+      jsonPath = argv[++i];
+    } else if (arg == "--baseline" && hasValue) {
+      baselinePath = argv[++i];
+    } else if (arg == "-h" || arg == "--help") {
+      printUsage();
+      return 0;
+    } else if (!arg.empty() && arg[0] == '-') {
+      printUsage();
+      return 1;
+    } else {
+      mapPaths.push_back(arg);
+    }
+  }
+  if (queryCount <= 0) {
+    printUsage();
+    return 1;
+  }
+  if (mapPaths.empty()) {
+    for (int level = 1; level <= 3; ++level) {
+      mapPaths.push_back(resourceDir + "/level/" + std::to_string(level) +
+                         ".json");
+    }
+  }
+
+  SimConfig config;
+  if (!config.loadFromDirectory(resourceDir)) {
+    std::cerr << "coc_pathbench: failed to load config from " << resourceDir
+              << std::endl;
+    return 1;
+  }
+  if (hasP00) {
+    config.setP00(p00);
+  }
+
+  std::mt19937 random(kSeed);
+  std::vector<BenchMap> maps;
+  maps.reserve(mapPaths.size() + 3);
+  for (const std::string& mapPath : mapPaths) {
+    std::vector<SimBuildingPlacement> layout;
+    if (!SimScenario::loadLayout(mapPath, layout)) {
+      std::cerr << "coc_pathbench: skipping " << mapPath << std::endl;
+      continue;
+    }
+    maps.emplace_back(mapPath, config.getProjection());
+    BenchMap& map = maps.back();
+    for (const SimBuildingPlacement& placement : layout) {
+      BattleBuildingStats stats;
+      if (config.getBuildingStats(placement.name, placement.level, stats)) {
+        map.world.addBuilding(placement.name, placement.level, stats,
+                              placement.row, placement.col, placement.hp);
+      }
+    }
+  }
+  if (synthetic) {
+    maps.emplace_back("open", config.getProjection());
+    buildOpenField(maps.back().world);
+    maps.emplace_back("rings", config.getProjection());
+    buildWalledRings(maps.back().world);
+    maps.emplace_back("maze", config.getProjection());
+    buildMaze(maps.back().world, random);
+  }
+  if (maps.empty()) {
+    printUsage();
+    return 1;
+  }
+  for (BenchMap& map : maps) {
+    map.queries = makeQueries(map.world, queryCount, random);
+    for (const BattleBuilding& building : map.world.getBuildings()) {
+      if (building.type == BuildingType::WALL) {
+        map.walls.setArea(static_cast<int>(building.row),
+                          static_cast<int>(building.col), 1, true);
+      }
+    }
+  }
+
+  struct Mode {
+    const char* name;
+    BattlePathFinder::Algorithm algorithm;
+  };
+  const Mode modes[] = {{"astar", BattlePathFinder::Algorithm::ASTAR},
+                        {"jps", BattlePathFinder::Algorithm::JPS}};
+  Json::Value rows(Json::arrayValue);
+  for (BenchMap& map : maps) {
+    for (int precision : precisions) {
+      std::printf("%s (precision %d)\n", map.path.c_str(), precision);
+      std::printf("  %-11s %7s %9s %10s %9s %9s %8s %8s\n", "algo",
+                  "queries", "success", "expanded", "p50_us", "p99_us",
+                  "allocs", "length");
+      for (const Mode& mode : modes) {
+        BattlePathFinder::setAlgorithm(mode.algorithm);
+        // 先运行一遍预热线程的搜索数组，只统计第二遍
+        runQueries(map, precision);
+        Json::Value row = toJson(map.path, precision, mode.name,
+                                 runQueries(map, precision));
+        printResult(row);
+        rows.append(row);
+      }
+      BattlePathFinder::setAlgorithm(BattlePathFinder::Algorithm::ASTAR);
+
+      runFlowFields(map, precision);
+      FlowResults flow = runFlowFields(map, precision);
+      runBreach(map, precision);
+      const std::pair<const char*, BenchResult> results[] = {
+          {"flow_build", flow.build},
+          {"flow_repair", flow.repair},
+          {"flow_trace", flow.trace},
+          {"breach", runBreach(map, precision)}};
+      for (const auto& result : results) {
+        Json::Value row =
+            toJson(map.path, precision, result.first, result.second);
+        printResult(row);
+        rows.append(row);
+      }
+    }
+  }
+
+  if (!jsonPath.empty() && !SimJson::writeFile(jsonPath, rows)) {
+    std::cerr << "coc_pathbench: failed to write " << jsonPath << std::endl;
+    return 1;
+  }
+  if (!baselinePath.empty()) {
+    Json::Value baseline;
+    if (!SimJson::readFile(baselinePath, baseline) || !baseline.isArray()) {
+      std::cerr << "coc_pathbench: failed to read " << baselinePath
+                << std::endl;
+      return 1;
+    }
+    printComparison(baseline, rows);
+  }
+  return 0;
+}
@@ -0,0 +1,382 @@
+#include "Sim/SimConfig.h"
+
+#include <fstream>
+#include <sstream>
+
+#include "Sim/SimJson.h"
+
+namespace {
+bool readText(const std::string& path, std::string& text) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  std::ostringstream content;
+  content << file.rdbuf();
+  text = content.str();
+  return true;
+}
+}  // namespace
+
+SimConfig::SimConfig()
+    : _gridSize(44),
+      _deltaX(40.0f),
+      _deltaY(30.0f),
+      _grassWidth(79.0f),
+      _designWidth(1280),
+      _designHeight(720),
+      _hasP00(false) {}
+
+bool SimConfig::loadFromDirectory(const std::string& resourceDir) {
+  struct ConfigFile {
+    const char* path;
+    bool (SimConfig::*parse)(const std::string&);
+  };
+  const ConfigFile files[] = {
+      {"config/soilder.json", &SimConfig::parseSoldierConfig},
+      {"config/building.json", &SimConfig::parseBuildingConfig},
+      {"config/spell.json", &SimConfig::parseSpellConfig},
+      {"config/constant.json", &SimConfig::parseConstantConfig},
+      {"config/background.json", &SimConfig::parseBackgroundConfig},
+  };
+
+  for (const ConfigFile& file : files) {
+    std::string text;
+    if (!readText(resourceDir + "/" + file.path, text) ||
+        !(this->*file.parse)(text)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool SimConfig::parseSoldierConfig(const std::string& text) {
+  Json::Value doc;
+  if (!SimJson::parse(text, doc) || !doc.isObject()) {
+    return false;
+  }
+
+  _soldiers.clear();
+  for (const std::string& key : doc.getMemberNames()) {
+    const Json::Value& typeConfig = doc[key];
+    if (!typeConfig.isObject()) {
+      continue;
+    }
+
+    SoldierConfig base;
+    if (typeConfig["AttackType"].isString()) {
+      BattleTypeUtils::parseAttackType(typeConfig["AttackType"].asString(),
+                                       base.attackType);
+    }
+    if (typeConfig["SoldierType"].isString()) {
+      BattleTypeUtils::parseSoldierCategory(
+          typeConfig["SoldierType"].asString(), base.category);
+    }
+
+    // 数字键为等级配置
+    for (const std::string& levelKey : typeConfig.getMemberNames()) {
+      const Json::Value& levelConfig = typeConfig[levelKey];
+      if (!levelConfig.isObject() || levelKey.empty() ||
+          levelKey.find_first_not_of("0123456789") != std::string::npos) {
+        continue;
+      }
+
+      SoldierConfig config = base;
+      SimJson::readFloat(levelConfig, "Attack", config.attack);
+      SimJson::readFloat(levelConfig, "Health", config.health);
+      SimJson::readFloat(levelConfig, "MoveSpeed", config.moveSpeed);
+      SimJson::readFloat(levelConfig, "AttackSpeed", config.attackSpeed);
+      SimJson::readFloat(levelConfig, "AttackRange", config.attackRange);
+      _soldiers[key][std::stoi(levelKey)] = config;
+    }
+  }
+  return true;
+}
+
+bool SimConfig::parseBuildingConfig(const std::string& text) {
+  Json::Value doc;
+  if (!SimJson::parse(text, doc) || !doc.isObject()) {
+    return false;
+  }
+
+  _buildings.clear();
+  for (const std::string& name : doc.getMemberNames()) {
+    const Json::Value& value = doc[name];
+    if (!value.isObject() || !value["type"].isString()) {
+      continue;
+    }
+
+    BuildingConfig base;
+    if (!BattleTypeUtils::parseBuildingType(value["type"].asString(),
+                                            base.type)) {
+      continue;
+    }
+    SimJson::readInt(value, "GridSize", base.gridCount);
+    int maxLevel = 10;
+    SimJson::readInt(value, "maxLevel", maxLevel);
+
+    // 与 ConfigManager::loadBuildingConfig 相同，缺失的等级沿用基础配置
+    for (int level = 1; level <= maxLevel; ++level) {
+      BuildingConfig config = base;
+      const Json::Value& levelValue = value[std::to_string(level)];
+      if (levelValue.isObject()) {
+        SimJson::readFloat(levelValue, "health", config.maxHP);
+        SimJson::readFloat(levelValue, "maxHP", config.maxHP);
+        SimJson::readInt(levelValue, "damage", config.damage);
+        SimJson::readFloat(levelValue, "attackRange", config.attackRange);
+        SimJson::readFloat(levelValue, "attackSpeed", config.attackSpeed);
+      }
+      _buildings[name][level] = config;
+    }
+  }
+  return true;
+}
+
+bool SimConfig::parseSpellConfig(const std::string& text) {
+  Json::Value doc;
+  if (!SimJson::parse(text, doc) || !doc.isObject()) {
+    return false;
+  }
+
+  _spells.clear();
+  for (const std::string& key : doc.getMemberNames()) {
+    const Json::Value& value = doc[key];
+    if (!value.isObject()) {
+      continue;
+    }
+
+    // 默认值与 ConfigManager::getSpellConfig 一致
+    BattleSpellStats stats;
+    if (value["Category"].isString()) {
+      BattleTypeUtils::parseSpellCategory(value["Category"].asString(),
+                                          stats.category);
+    }
+    float duration = 0.0f;
+    float radius = 100.0f;
+    float amount = 100.0f;
+    float ratio = 1.0f;
+    SimJson::readFloat(value, "Duration", duration);
+    SimJson::readFloat(value, "Radius", radius);
+    SimJson::readFloat(value, "Amount", amount);
+    SimJson::readFloat(value, "Ratio", ratio);
+    stats.duration = duration;
+    stats.radius = radius;
+    stats.amount = amount;
+    stats.ratio = ratio;
+    _spells[key] = stats;
+  }
+  return true;
+}
+
+bool SimConfig::parseConstantConfig(const std::string& text) {
+  Json::Value doc;
+  if (!SimJson::parse(text, doc) || !doc.isObject()) {
+    return false;
+  }
+
+  SimJson::readInt(doc, "GridSize", _gridSize);
+  if (doc["GrassImage"].isObject()) {
+    SimJson::readFloat(doc["GrassImage"], "width", _grassWidth);
+  }
+  if (doc["GridDelta"].isObject()) {
+    SimJson::readFloat(doc["GridDelta"], "deltaX", _deltaX);
+    SimJson::readFloat(doc["GridDelta"], "deltaY", _deltaY);
+  }
+  return true;
+}
+
+bool SimConfig::parseBackgroundConfig(const std::string& text) {
+  Json::Value doc;
+  if (!SimJson::parse(text, doc) || !doc.isObject()) {
+    return false;
+  }
+
+  if (doc["ResolutionSize"].isObject()) {
+    SimJson::readInt(doc["ResolutionSize"], "width", _designWidth);
+    SimJson::readInt(doc["ResolutionSize"], "height", _designHeight);
+  }
+  return true;
+}
+
+bool SimConfig::getSoldierStats(SoldierType type, int level,
+                                BattleSoldierStats& stats) const {
+  auto typeIt = _soldiers.find(BattleTypeUtils::soldierTypeKey(type));
+  if (typeIt == _soldiers.end()) {
+    return false;
+  }
+  auto levelIt = typeIt->second.find(level);
+  if (levelIt == typeIt->second.end()) {
+    return false;
+  }
+
+  const SoldierConfig& config = levelIt->second;
+  stats = BattleSoldierStats();
+  stats.maxHP = config.health;
+  stats.attackDamage = config.attack;
+  stats.attackSpeed =
+      BattleSoldierStats::attacksPerSecondFromConfig(config.attackSpeed);
+  stats.moveSpeed = config.moveSpeed;
+  stats.attackRange = config.attackRange;
+  stats.attackType = config.attackType;
+  stats.category = config.category;
+  return true;
+}
+
+bool SimConfig::getBuildingStats(const std::string& name, int level,
+                                 BattleBuildingStats& stats) const {
+  const BuildingConfig* config = getBuildingConfig(name, level);
+  if (!config) {
+    return false;
+  }
+
+  stats = BattleBuildingStats();
+  stats.type = config->type;
+  stats.gridCount = config->gridCount;
+  stats.maxHP = config->maxHP;
+
+  switch (config->type) {
+    case BuildingType::TOWN_HALL:
+    case BuildingType::WALL: {
+      // TownHall 和 Wall 精灵读取的是 1 级配置的生命值
+      const BuildingConfig* baseConfig = getBuildingConfig(name, 1);
+      stats.maxHP = baseConfig->maxHP;
+      break;
+    }
+    case BuildingType::DEFENSE:
+      stats.damage = config->damage;
+      stats.attackSpeed = config->attackSpeed;
+      stats.attackRange = config->attackRange;
+      break;
+    case BuildingType::TRAP:
+      stats.damage = config->damage;
+      stats.attackRange = config->attackRange;
+      break;
+    default:
+      break;
+  }
+  return true;
+}
+
+bool SimConfig::getSpellStats(SpellType type, BattleSpellStats& stats) const {
+  auto it = _spells.find(BattleTypeUtils::spellTypeKey(type));
+  if (it == _spells.end()) {
+    return false;
+  }
+  stats = it->second;
+  return true;
+}
+
+BattleProjection SimConfig::getProjection() const {
+  BattleProjection projection;
+  projection.deltaX = _deltaX;
+  projection.deltaY = _deltaY;
+  projection.gridSize = _gridSize;
+
+  if (_hasP00) {
+    projection.p00 = _p00;
+  } else {
+    float totalWidth = (_grassWidth / 2.0f) * 84 + _grassWidth;
+    projection.p00 = BattleVec2((_designWidth - totalWidth) / 2,
+                                _designHeight / 2.0f);
+  }
+  return projection;
+}
+
+void SimConfig::setP00(const BattleVec2& p00) {
+  _p00 = p00;
+  _hasP00 = true;
+}
+
+SimConfig::SoldierConfig* SimConfig::findSoldierConfig(const std::string& key,
+                                                       int level) {
+  auto typeIt = _soldiers.find(key);
+  if (typeIt == _soldiers.end()) {
+    return nullptr;
+  }
+  auto levelIt = typeIt->second.find(level);
+  return levelIt != typeIt->second.end() ? &levelIt->second : nullptr;
+}
+
+SimConfig::BuildingConfig* SimConfig::findBuildingConfig(
+    const std::string& name, int level) {
+  auto nameIt = _buildings.find(name);
+  if (nameIt == _buildings.end()) {
+    return nullptr;
+  }
+  auto levelIt = nameIt->second.find(level);
+  return levelIt != nameIt->second.end() ? &levelIt->second : nullptr;
+}
+
+bool SimConfig::setSoldierValue(const std::string& key, int level,
+                                const std::string& field, float value) {
+  auto typeIt = _soldiers.find(key);
+  if (typeIt == _soldiers.end()) {
+    return false;
+  }
+
+  bool changed = false;
+  for (auto& entry : typeIt->second) {
+    if (level > 0 && entry.first != level) {
+      continue;
+    }
+    SoldierConfig& config = entry.second;
+    if (field == "Attack") {
+      config.attack = value;
+    } else if (field == "Health") {
+      config.health = value;
+    } else if (field == "MoveSpeed") {
+      config.moveSpeed = value;
+    } else if (field == "AttackSpeed") {
+      config.attackSpeed = value;
+    } else if (field == "AttackRange") {
+      config.attackRange = value;
+    } else {
+      return false;
+    }
+    changed = true;
+  }
+  return changed;
+}
+
+bool SimConfig::setBuildingValue(const std::string& name, int level,
+                                 const std::string& field, float value) {
+  auto nameIt = _buildings.find(name);
+  if (nameIt == _buildings.end()) {
+    return false;
+  }
+
+  bool changed = false;
+  for (auto& entry : nameIt->second) {
+    if (level > 0 && entry.first != level) {
+      continue;
+    }
+    BuildingConfig& config = entry.second;
+    if (field == "health" || field == "maxHP") {
+      config.maxHP = value;
+    } else if (field == "damage") {
+      config.damage = static_cast<int>(value + 0.5f);
+    } else if (field == "attackSpeed") {
+      config.attackSpeed = value;
+    } else if (field == "attackRange") {
+      config.attackRange = value;
+    } else {
+      return false;
+    }
+    changed = true;
+  }
+  return changed;
+}
+
+const SimConfig::BuildingConfig* SimConfig::getBuildingConfig(
+    const std::string& name, int level) const {
+  auto nameIt = _buildings.find(name);
+  if (nameIt == _buildings.end() || nameIt->second.empty()) {
+    return nullptr;
+  }
+  // 没有该等级时回退到最低等级（与 ConfigManager::getBuildingConfig 一致）
+  auto levelIt = nameIt->second.find(level);
+  if (levelIt == nameIt->second.end()) {
+    levelIt = nameIt->second.begin();
+  }
+  return &levelIt->second;
+}
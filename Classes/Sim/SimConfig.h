@@ -0,0 +1,131 @@
+#ifndef __SIM_CONFIG_H__
+#define __SIM_CONFIG_H__
+
+#include <map>
+#include <string>
+
+#include "Battle/BattleEntities.h"
+#include "Battle/BattleGrid.h"
+
+/**
+ * 无头模拟使用的游戏配置
+ * 读取 Resources/config 下与 ConfigManager 相同的配置文件，
+ * 并按游戏中精灵初始化的方式换算为战斗核心的属性
+ */
+class SimConfig {
+ public:
+  /**
+   * 士兵配置（soilder.json 中的一个等级）
+   */
+  struct SoldierConfig {
+    AttackType attackType = AttackType::ANY;
+    SoldierCategory category = SoldierCategory::LAND;
+    float attack = 0.0f;       // Attack
+    float health = 0.0f;       // Health
+    float moveSpeed = 0.0f;    // MoveSpeed
+    float attackSpeed = 0.0f;  // AttackSpeed（速度值或攻击间隔）
+    float attackRange = 0.0f;  // AttackRange
+  };
+
+  /**
+   * 建筑配置（building.json 中的一个等级）
+   */
+  struct BuildingConfig {
+    BuildingType type = BuildingType::RESOURCE;
+    int gridCount = 1;
+    float maxHP = 1000.0f;
+    int damage = 0;
+    float attackSpeed = 0.0f;
+    float attackRange = 0.0f;
+  };
+
+  SimConfig();
+
+  /**
+   * 从资源目录加载全部配置
+   * @param resourceDir 资源根目录（包含 config/ 子目录）
+   * @return 任一配置文件读取失败时返回 false
+   */
+  bool loadFromDirectory(const std::string& resourceDir);
+
+  /**
+   * 解析各配置文件的 JSON 文本
+   */
+  bool parseSoldierConfig(const std::string& text);
+  bool parseBuildingConfig(const std::string& text);
+  bool parseSpellConfig(const std::string& text);
+  bool parseConstantConfig(const std::string& text);
+  bool parseBackgroundConfig(const std::string& text);
+
+  /**
+   * 获取士兵属性（与 BasicSoldier::init 的换算一致）
+   * @return 没有该兵种或等级的配置时返回 false
+   */
+  bool getSoldierStats(SoldierType type, int level,
+                       BattleSoldierStats& stats) const;
+
+  /**
+   * 获取建筑属性（与各建筑精灵的 getBattleStats 一致）
+   * @return 没有该建筑的配置时返回 false
+   */
+  bool getBuildingStats(const std::string& name, int level,
+                        BattleBuildingStats& stats) const;
+
+  /**
+   * 获取法术属性
+   */
+  bool getSpellStats(SpellType type, BattleSpellStats& stats) const;
+
+  /**
+   * 网格投影
+   * 地图原点 p00 按设计分辨率计算（与 BasicScene::calculateP00 一致），
+   * 记录中的部署坐标以此为基准
+   */
+  BattleProjection getProjection() const;
+
+  /**
+   * 覆盖地图原点（录制时窗口分辨率与设计分辨率不同时使用）
+   */
+  void setP00(const BattleVec2& p00);
+
+  /**
+   * 原始配置，可直接修改以注入参数
+   */
+  SoldierConfig* findSoldierConfig(const std::string& key, int level);
+  BuildingConfig* findBuildingConfig(const std::string& name, int level);
+
+  /**
+   * 按配置文件中的字段名修改数值，用于参数扫描时在内存中注入配置
+   * 士兵字段：Attack, Health, MoveSpeed, AttackSpeed, AttackRange
+   * 建筑字段：health（或 maxHP）, damage, attackSpeed,
+   *           attackRange（网格数，防御建筑和陷阱都会按它换算攻击范围）
+   * @param level 等级，<= 0 时修改该兵种/建筑的全部等级
+   * @return 兵种/建筑、等级或字段不存在时返回 false
+   */
+  bool setSoldierValue(const std::string& key, int level,
+                       const std::string& field, float value);
+  bool setBuildingValue(const std::string& name, int level,
+                        const std::string& field, float value);
+
+ private:
+  const BuildingConfig* getBuildingConfig(const std::string& name,
+                                          int level) const;
+
+  // 兵种键（如 "barbarian"）-> 等级 -> 配置
+  std::map<std::string, std::map<int, SoldierConfig>> _soldiers;
+  // 建筑名称（如 "Cannon"）-> 等级 -> 配置
+  std::map<std::string, std::map<int, BuildingConfig>> _buildings;
+  // 法术键（如 "Heal"）-> 配置
+  std::map<std::string, BattleSpellStats> _spells;
+
+  int _gridSize;
+  float _deltaX;
+  float _deltaY;
+  float _grassWidth;
+  int _designWidth;
+  int _designHeight;
+  bool _hasP00;
+  BattleVec2 _p00;
+};
+
+#endif  // __SIM_CONFIG_H__
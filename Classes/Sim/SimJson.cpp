@@ -0,0 +1,53 @@
+#include "Sim/SimJson.h"
+
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+bool SimJson::parse(const std::string& text, Json::Value& doc) {
+  Json::CharReaderBuilder builder;
+  std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
+  std::string errors;
+  return reader->parse(text.data(), text.data() + text.size(), &doc, &errors);
+}
+
+bool SimJson::readFile(const std::string& path, Json::Value& doc) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  std::ostringstream content;
+  content << file.rdbuf();
+  return parse(content.str(), doc);
+}
+
+std::string SimJson::write(const Json::Value& doc, bool pretty) {
+  Json::StreamWriterBuilder builder;
+  builder["indentation"] = pretty ? "  " : "";
+  builder["emitUTF8"] = true;
+  return Json::writeString(builder, doc);
+}
+
+bool SimJson::writeFile(const std::string& path, const Json::Value& doc) {
+  std::ofstream file(path, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  file << write(doc);
+  return static_cast<bool>(file);
+}
+
+void SimJson::readFloat(const Json::Value& object, const char* key,
+                        float& value) {
+  const Json::Value& field = object[key];
+  if (field.isNumeric()) {
+    value = field.asFloat();
+  }
+}
+
+void SimJson::readInt(const Json::Value& object, const char* key, int& value) {
+  const Json::Value& field = object[key];
+  if (field.isNumeric()) {
+    value = field.asInt();
+  }
+}
@@ -0,0 +1,45 @@
+#ifndef __SIM_JSON_H__
+#define __SIM_JSON_H__
+
+#include <json/json.h>
+
+#include <string>
+
+/**
+ * 无头工具使用的 JSON 读写
+ * 游戏中的 rapidjson 随引擎提供，无头构建中使用系统的 jsoncpp
+ */
+class SimJson {
+ public:
+  /**
+   * 解析 JSON 文本
+   * @return 是否解析成功
+   */
+  static bool parse(const std::string& text, Json::Value& doc);
+
+  /**
+   * 读取并解析 JSON 文件
+   * @return 文件不存在或解析失败时返回 false
+   */
+  static bool readFile(const std::string& path, Json::Value& doc);
+
+  /**
+   * 序列化为 JSON 文本
+   * @param pretty 是否缩进排版
+   */
+  static std::string write(const Json::Value& doc, bool pretty = false);
+
+  /**
+   * 写入 JSON 文件
+   */
+  static bool writeFile(const std::string& path, const Json::Value& doc);
+
+  /**
+   * 读取数值字段，字段不存在或不是数值时保持 value 不变
+   */
+  static void readFloat(const Json::Value& object, const char* key,
+                        float& value);
+  static void readInt(const Json::Value& object, const char* key, int& value);
+};
+
+#endif  // __SIM_JSON_H__
@@ -0,0 +1,170 @@
+/**
+ * coc_sim：无头批量战斗模拟
+ *
+ * 用法：
+ *   coc_sim [--resources DIR] [--threads N] [--p00 X,Y]
+ *           [--summary FILE] [MAP RECORD]...
+ *
+ * MAP 为 Resources/level/<name>.json 或 develop/map.json 格式的布局，
+ * RECORD 为 Resources/record/<name>.json 格式的进攻记录。
+ * --summary 读取 record/summary.json，批量重新评分其中的全部记录，
+ * 其中的路径相对于资源目录。
+ * 结果按输入顺序以 JSON 数组输出到标准输出
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Sim/BattleSimulator.h"
+#include "Sim/SimConfig.h"
+#include "Sim/SimJson.h"
+#include "Sim/SimScenario.h"
+#include "Sim/SimThreadPool.h"
+
+namespace {
+struct SimJob {
+  SimBattleFile files;
+  bool ok = false;
+  std::string error;
+  SimReport report;
+};
+
+void printUsage() {
+  std::cerr << "usage: coc_sim [--resources DIR] [--threads N] [--p00 X,Y]"
+               " [--summary FILE] [MAP RECORD]..."
+            << std::endl;
+}
+
+void runJob(const BattleSimulator& simulator, SimJob& job) {
+  std::vector<SimBuildingPlacement> layout;
+  if (!SimScenario::loadLayout(job.files.mapPath, layout)) {
+    job.error = "failed to load map";
+    return;
+  }
+  SimRecord record;
+  if (!SimScenario::loadRecord(job.files.recordPath, simulator.getTickRate(),
+                               record)) {
+    job.error = "failed to load record";
+    return;
+  }
+  job.report = simulator.run(layout, record);
+  job.ok = true;
+}
+
+Json::Value toJson(const SimJob& job) {
+  Json::Value value(Json::objectValue);
+  value["map"] = job.files.mapPath;
+  value["record"] = job.files.recordPath;
+  if (!job.ok) {
+    value["error"] = job.error;
+    return value;
+  }
+
+  const SimReport& report = job.report;
+  value["stars"] = report.result.stars;
+  value["ratio"] = report.result.ratio;
+  value["win"] = report.result.win;
+  value["duration"] = report.duration;
+  value["ticks"] = report.ticks;
+  value["deployed"] = report.deployed;
+
+  Json::Value buildings(Json::arrayValue);
+  for (const SimBuildingReport& building : report.buildings) {
+    Json::Value item(Json::objectValue);
+    item["name"] = building.name;
+    item["level"] = building.level;
+    item["maxHP"] = building.maxHP;
+    item["damage"] = building.damage;
+    item["destroyed"] = building.destroyed;
+    buildings.append(item);
+  }
+  value["buildings"] = buildings;
+  return value;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::string resourceDir = "Resources";
+  std::string summaryPath;
+  int threadCount = 0;
+  bool hasP00 = false;
+  BattleVec2 p00;
+  std::vector<std::string> positional;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (arg == "--resources" && hasValue) {
+      resourceDir = argv[++i];
+    } else if (arg == "--threads" && hasValue) {
+      threadCount = std::atoi(argv[++i]);
+    } else if (arg == "--summary" && hasValue) {
+      summaryPath = argv[++i];
+    } else if (arg == "--p00" && hasValue) {
+      float x = 0.0f;
+      float y = 0.0f;
+      if (std::sscanf(argv[++i], "%f,%f", &x, &y) != 2) {
+        printUsage();
+        return 1;
+      }
+      p00 = BattleVec2(x, y);
+      hasP00 = true;
+    } else if (arg == "-h" || arg == "--help") {
+      printUsage();
+      return 0;
+    } else if (!arg.empty() && arg[0] == '-') {
+      printUsage();
+      return 1;
+    } else {
+      positional.push_back(arg);
+    }
+  }
+
+  if (positional.size() % 2 != 0) {
+    std::cerr << "coc_sim: MAP and RECORD must be given in pairs" << std::endl;
+    return 1;
+  }
+
+  std::vector<SimBattleFile> battles;
+  if (!summaryPath.empty() &&
+      !SimScenario::loadSummary(summaryPath, resourceDir, battles)) {
+    std::cerr << "coc_sim: failed to read " << summaryPath << std::endl;
+    return 1;
+  }
+  for (size_t i = 0; i < positional.size(); i += 2) {
+    battles.push_back({positional[i], positional[i + 1]});
+  }
+
+  std::vector<SimJob> jobs(battles.size());
+  for (size_t i = 0; i < battles.size(); ++i) {
+    jobs[i].files = battles[i];
+  }
+  if (jobs.empty()) {
+    printUsage();
+    return 1;
+  }
+
+  SimConfig config;
+  if (!config.loadFromDirectory(resourceDir)) {
+    std::cerr << "coc_sim: failed to load config from " << resourceDir
+              << std::endl;
+    return 1;
+  }
+  if (hasP00) {
+    config.setP00(p00);
+  }
+
+  BattleSimulator simulator(config);
+  SimThreadPool pool(threadCount);
+  pool.parallelFor(static_cast<int>(jobs.size()),
+                   [&](int index) { runJob(simulator, jobs[index]); });
+
+  Json::Value output(Json::arrayValue);
+  for (const SimJob& job : jobs) {
+    output.append(toJson(job));
+  }
+  std::cout << SimJson::write(output, true) << std::endl;
+  return 0;
+}
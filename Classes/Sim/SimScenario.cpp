@@ -0,0 +1,195 @@
+#include "Sim/SimScenario.h"
+
+#include <algorithm>
+
+#include "Sim/SimJson.h"
+
+namespace {
+bool parseLayoutDocument(const Json::Value& doc,
+                         std::vector<SimBuildingPlacement>& layout) {
+  if (!doc.isObject()) {
+    return false;
+  }
+
+  layout.clear();
+  for (const std::string& name : doc.getMemberNames()) {
+    const Json::Value& array = doc[name];
+    if (!array.isArray()) {
+      continue;
+    }
+    for (const Json::Value& item : array) {
+      if (!item.isObject() || !item["row"].isNumeric() ||
+          !item["col"].isNumeric()) {
+        continue;
+      }
+      SimBuildingPlacement building;
+      building.name = name;
+      building.row = item["row"].asFloat();
+      building.col = item["col"].asFloat();
+      SimJson::readInt(item, "level", building.level);
+      SimJson::readFloat(item, "HP", building.hp);
+      layout.push_back(building);
+    }
+  }
+  return true;
+}
+
+bool parseRecordDocument(const Json::Value& doc, int tickRate,
+                         SimRecord& record) {
+  if (!doc.isObject() || !doc["records"].isArray()) {
+    return false;
+  }
+
+  record = SimRecord();
+  for (const Json::Value& item : doc["records"]) {
+    if (!item.isObject() || !item["type"].isString() ||
+        !item["category"].isString()) {
+      continue;
+    }
+    SimPlacement placement;
+    placement.type = item["type"].asString();
+    placement.category = item["category"].asString();
+    SimJson::readInt(item, "level", placement.level);
+    SimJson::readFloat(item, "x", placement.x);
+    SimJson::readFloat(item, "y", placement.y);
+    SimJson::readInt(item, "timestamp", placement.timestamp);
+    SimJson::readInt(item, "tick", placement.tick);
+    if (placement.tick < 0) {
+      placement.tick = placement.timestamp * tickRate;
+    }
+    record.placements.push_back(placement);
+  }
+
+  if (doc["metadata"].isObject()) {
+    SimJson::readInt(doc["metadata"], "duration", record.duration);
+  }
+
+  // 与 RecordScene 一致，同一帧的部署保持记录中的顺序
+  std::stable_sort(record.placements.begin(), record.placements.end(),
+                   [](const SimPlacement& a, const SimPlacement& b) {
+                     return a.tick < b.tick;
+                   });
+  return true;
+}
+
+bool parseArmyDocument(const Json::Value& doc, SimArmy& army) {
+  if (!doc.isObject()) {
+    return false;
+  }
+
+  army = SimArmy();
+  for (const Json::Value& item : doc["troop"]) {
+    if (!item.isObject()) {
+      continue;
+    }
+    SimTroopItem troop;
+    if (item["Category"].isString()) {
+      troop.category = item["Category"].asString();
+    }
+    SimJson::readInt(item, "Level", troop.level);
+    SimJson::readInt(item, "Count", troop.count);
+    army.troops.push_back(troop);
+  }
+  for (const Json::Value& item : doc["spell"]) {
+    if (!item.isObject()) {
+      continue;
+    }
+    SimSpellItem spell;
+    if (item["Category"].isString()) {
+      spell.category = item["Category"].asString();
+    }
+    SimJson::readInt(item, "Count", spell.count);
+    army.spells.push_back(spell);
+  }
+  return true;
+}
+
+Json::Value recordToJson(const SimRecord& record) {
+  Json::Value records(Json::arrayValue);
+  for (const SimPlacement& placement : record.placements) {
+    Json::Value item;
+    item["type"] = placement.type;
+    item["category"] = placement.category;
+    if (placement.type == "troop") {
+      item["level"] = placement.level;
+    }
+    item["x"] = placement.x;
+    item["y"] = placement.y;
+    item["timestamp"] = placement.timestamp;
+    if (placement.tick >= 0) {
+      item["tick"] = placement.tick;
+    }
+    records.append(item);
+  }
+
+  Json::Value doc;
+  doc["records"] = records;
+  doc["metadata"]["totalRecords"] = static_cast<int>(record.placements.size());
+  doc["metadata"]["duration"] = record.duration;
+  return doc;
+}
+}  // namespace
+
+bool SimScenario::loadLayout(const std::string& path,
+                             std::vector<SimBuildingPlacement>& layout) {
+  Json::Value doc;
+  return SimJson::readFile(path, doc) && parseLayoutDocument(doc, layout);
+}
+
+bool SimScenario::parseLayout(const std::string& text,
+                              std::vector<SimBuildingPlacement>& layout) {
+  Json::Value doc;
+  return SimJson::parse(text, doc) && parseLayoutDocument(doc, layout);
+}
+
+bool SimScenario::loadRecord(const std::string& path, int tickRate,
+                             SimRecord& record) {
+  Json::Value doc;
+  return SimJson::readFile(path, doc) &&
+         parseRecordDocument(doc, tickRate, record);
+}
+
+bool SimScenario::parseRecord(const std::string& text, int tickRate,
+                              SimRecord& record) {
+  Json::Value doc;
+  return SimJson::parse(text, doc) &&
+         parseRecordDocument(doc, tickRate, record);
+}
+
+bool SimScenario::loadSummary(const std::string& path,
+                              const std::string& resourceDir,
+                              std::vector<SimBattleFile>& battles) {
+  Json::Value doc;
+  if (!SimJson::readFile(path, doc) || !doc["records"].isArray()) {
+    return false;
+  }
+  for (const Json::Value& entry : doc["records"]) {
+    if (!entry["mapPath"].isString() || !entry["recordPath"].isString()) {
+      continue;
+    }
+    SimBattleFile battle;
+    battle.mapPath = resourceDir + "/" + entry["mapPath"].asString();
+    battle.recordPath = resourceDir + "/" + entry["recordPath"].asString();
+    battles.push_back(battle);
+  }
+  return true;
+}
+
+bool SimScenario::loadArmy(const std::string& path, SimArmy& army) {
+  Json::Value doc;
+  return SimJson::readFile(path, doc) && parseArmyDocument(doc, army);
+}
+
+bool SimScenario::parseArmy(const std::string& text, SimArmy& army) {
+  Json::Value doc;
+  return SimJson::parse(text, doc) && parseArmyDocument(doc, army);
+}
+
+bool SimScenario::saveRecord(const std::string& path,
+                             const SimRecord& record) {
+  return SimJson::writeFile(path, recordToJson(record));
+}
+
+std::string SimScenario::writeRecord(const SimRecord& record) {
+  return SimJson::write(recordToJson(record));
+}
@@ -0,0 +1,121 @@
+#ifndef __SIM_SCENARIO_H__
+#define __SIM_SCENARIO_H__
+
+#include <string>
+#include <vector>
+
+/**
+ * 基地布局中的一个建筑（Resources/level/<name>.json 或 develop/map.json）
+ */
+struct SimBuildingPlacement {
+  std::string name;  // 建筑名称（如 "Cannon"）
+  float row = 0.0f;
+  float col = 0.0f;
+  int level = 1;
+  float hp = -1.0f;  // 当前生命值，< 0 表示满血
+};
+
+/**
+ * 进攻记录中的一次部署（Resources/record/<name>.json）
+ */
+struct SimPlacement {
+  std::string type;      // "troop" 或 "spell"
+  std::string category;  // 如 "barbarian", "Heal"
+  int level = 1;
+  float x = 0.0f;  // 地图层坐标
+  float y = 0.0f;
+  int timestamp = 0;  // 秒
+  int tick = -1;      // 逻辑帧序号，-1 表示按时间戳换算
+};
+
+/**
+ * 一份进攻记录
+ */
+struct SimRecord {
+  std::vector<SimPlacement> placements;
+  int duration = 180;  // 进攻时长（秒）
+};
+
+/**
+ * 一场待模拟战斗的布局和记录文件路径
+ */
+struct SimBattleFile {
+  std::string mapPath;
+  std::string recordPath;
+};
+
+/**
+ * 携带的一种士兵（config/troop.json 的 troop 项，对应 TroopItem）
+ */
+struct SimTroopItem {
+  std::string category;  // 如 "barbarian"
+  int level = 1;
+  int count = 0;
+};
+
+/**
+ * 携带的一种法术（config/troop.json 的 spell 项，对应 SpellItem）
+ */
+struct SimSpellItem {
+  std::string category;  // 如 "Heal"
+  int count = 0;
+};
+
+/**
+ * 进攻方携带的军队和法术
+ */
+struct SimArmy {
+  std::vector<SimTroopItem> troops;
+  std::vector<SimSpellItem> spells;
+};
+
+/**
+ * 布局和记录文件的读写，格式与 BuildingManager、RecordManager 相同
+ */
+class SimScenario {
+ public:
+  /**
+   * 读取基地布局
+   * 布局文件中每个建筑名称对应一个 {row, col, level, HP} 数组
+   * @return 文件不存在或格式错误时返回 false
+   */
+  static bool loadLayout(const std::string& path,
+                         std::vector<SimBuildingPlacement>& layout);
+  static bool parseLayout(const std::string& text,
+                          std::vector<SimBuildingPlacement>& layout);
+
+  /**
+   * 读取进攻记录，部署按逻辑帧排序
+   * @param tickRate 旧记录（没有 tick 字段）按时间戳换算时使用的逻辑帧率
+   */
+  static bool loadRecord(const std::string& path, int tickRate,
+                         SimRecord& record);
+  static bool parseRecord(const std::string& text, int tickRate,
+                          SimRecord& record);
+
+  /**
+   * 读取 record/summary.json 中列出的全部战斗
+   * @param resourceDir 资源目录，summary 中的路径相对于该目录
+   */
+  static bool loadSummary(const std::string& path,
+                          const std::string& resourceDir,
+                          std::vector<SimBattleFile>& battles);
+
+  /**
+   * 读取军队配置，格式与 TroopManager::loadTroopConfig 相同
+   */
+  static bool loadArmy(const std::string& path, SimArmy& army);
+  static bool parseArmy(const std::string& text, SimArmy& army);
+
+  /**
+   * 将记录保存为 RecordScene 可以回放的文件
+   */
+  static bool saveRecord(const std::string& path, const SimRecord& record);
+
+  /**
+   * 将记录转换为 JSON 文本（与 saveRecord 写入的内容相同）
+   */
+  static std::string writeRecord(const SimRecord& record);
+};
+
+#endif  // __SIM_SCENARIO_H__
@@ -0,0 +1,45 @@
+#include "Sim/SimThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+SimThreadPool::SimThreadPool(int threadCount) : _threadCount(threadCount) {
+  if (_threadCount <= 0) {
+    _threadCount = static_cast<int>(std::thread::hardware_concurrency());
+  }
+  if (_threadCount <= 0) {
+    _threadCount = 1;
+  }
+}
+
+void SimThreadPool::parallelFor(int count,
+                                const std::function<void(int)>& task) const {
+  if (count <= 0) {
+    return;
+  }
+
+  std::atomic<int> next(0);
+  auto worker = [&] {
+    while (true) {
+      int index = next.fetch_add(1);
+      if (index >= count) {
+        return;
+      }
+      task(index);
+    }
+  };
+
+  // 当前线程也参与计算
+  int extraThreads = std::min(_threadCount, count) - 1;
+  std::vector<std::thread> threads;
+  threads.reserve(extraThreads);
+  for (int i = 0; i < extraThreads; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
@@ -0,0 +1,32 @@
+#ifndef __SIM_THREAD_POOL_H__
+#define __SIM_THREAD_POOL_H__
+
+#include <functional>
+
+/**
+ * 批量模拟使用的线程池
+ * parallelFor 启动固定数量的工作线程，各线程循环领取下一个下标，
+ * 耗时不均的战斗也能均匀分摊。每场战斗相互独立，任务之间不需要同步。
+ * 一批任务通常是成百上千场完整战斗，线程创建的开销可以忽略
+ */
+class SimThreadPool {
+ public:
+  /**
+   * 构造函数
+   * @param threadCount 线程数，<= 0 时使用机器的硬件线程数
+   */
+  explicit SimThreadPool(int threadCount = 0);
+
+  int getThreadCount() const { return _threadCount; }
+
+  /**
+   * 对 [0, count) 中的每个下标调用 task，阻塞直到全部完成
+   * task 会在多个线程中并发调用
+   */
+  void parallelFor(int count, const std::function<void(int)>& task) const;
+
+ private:
+  int _threadCount;
+};
+
+#endif  // __SIM_THREAD_POOL_H__
@@ -0,0 +1,147 @@
+/**
+ * coc_sweep：数值平衡扫描
+ *
+ * 用法：
+ *   coc_sweep --spec FILE [--resources DIR] [--threads N] [--p00 X,Y]
+ *             [--format csv|json] [--summary FILE] [MAP RECORD]...
+ *
+ * FILE 为扫描方案（格式见 BalanceSweep::loadSpec），战斗的指定方式与
+ * coc_sim 相同。每个采样点的胜率、平均星数和平均摧毁比例输出到标准输出
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Battle/BattleClock.h"
+#include "Sim/BalanceSweep.h"
+#include "Sim/SimConfig.h"
+#include "Sim/SimScenario.h"
+#include "Sim/SimThreadPool.h"
+
+namespace {
+void printUsage() {
+  std::cerr << "usage: coc_sweep --spec FILE [--resources DIR] [--threads N]"
+               " [--p00 X,Y] [--format csv|json] [--summary FILE]"
+               " [MAP RECORD]..."
+            << std::endl;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::string resourceDir = "Resources";
+  std::string specPath;
+  std::string summaryPath;
+  std::string format = "csv";
+  int threadCount = 0;
+  bool hasP00 = false;
+  BattleVec2 p00;
+  std::vector<std::string> positional;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (arg == "--resources" && hasValue) {
+      resourceDir = argv[++i];
+    } else if (arg == "--spec" && hasValue) {
+      specPath = argv[++i];
+    } else if (arg == "--summary" && hasValue) {
+      summaryPath = argv[++i];
+    } else if (arg == "--format" && hasValue) {
+      format = argv[++i];
+    } else if (arg == "--threads" && hasValue) {
+      threadCount = std::atoi(argv[++i]);
+    } else if (arg == "--p00" && hasValue) {
+      float x = 0.0f;
+      float y = 0.0f;
+      if (std::sscanf(argv[++i], "%f,%f", &x, &y) != 2) {
+        printUsage();
+        return 1;
+      }
+      p00 = BattleVec2(x, y);
+      hasP00 = true;
+    } else if (arg == "-h" || arg == "--help") {
+      printUsage();
+      return 0;
+    } else if (!arg.empty() && arg[0] == '-') {
+      printUsage();
+      return 1;
+    } else {
+      positional.push_back(arg);
+    }
+  }
+
+  if (specPath.empty() || positional.size() % 2 != 0 ||
+      (format != "csv" && format != "json")) {
+    printUsage();
+    return 1;
+  }
+
+  SweepSpec spec;
+  if (!BalanceSweep::loadSpec(specPath, spec)) {
+    std::cerr << "coc_sweep: failed to read " << specPath << std::endl;
+    return 1;
+  }
+
+  SimConfig config;
+  if (!config.loadFromDirectory(resourceDir)) {
+    std::cerr << "coc_sweep: failed to load config from " << resourceDir
+              << std::endl;
+    return 1;
+  }
+  if (hasP00) {
+    config.setP00(p00);
+  }
+
+  // 提前检查字段，避免扫描中途才发现拼写错误
+  SimConfig probe = config;
+  std::vector<float> minValues;
+  for (const SweepParameter& parameter : spec.parameters) {
+    minValues.push_back(parameter.min);
+  }
+  if (!BalanceSweep::applyValues(spec.parameters, minValues, probe)) {
+    std::cerr << "coc_sweep: unknown parameter in " << specPath << std::endl;
+    return 1;
+  }
+
+  std::vector<SimBattleFile> files;
+  if (!summaryPath.empty() &&
+      !SimScenario::loadSummary(summaryPath, resourceDir, files)) {
+    std::cerr << "coc_sweep: failed to read " << summaryPath << std::endl;
+    return 1;
+  }
+  for (size_t i = 0; i < positional.size(); i += 2) {
+    files.push_back({positional[i], positional[i + 1]});
+  }
+
+  std::vector<SweepBattle> battles;
+  for (const SimBattleFile& file : files) {
+    SweepBattle battle;
+    if (!SimScenario::loadLayout(file.mapPath, battle.layout) ||
+        !SimScenario::loadRecord(file.recordPath,
+                                 BattleClock::DEFAULT_TICK_RATE,
+                                 battle.record)) {
+      std::cerr << "coc_sweep: skipping " << file.mapPath << " "
+                << file.recordPath << std::endl;
+      continue;
+    }
+    battles.push_back(battle);
+  }
+  if (battles.empty()) {
+    printUsage();
+    return 1;
+  }
+
+  std::vector<std::vector<float>> samples = BalanceSweep::makeSamples(spec);
+  SimThreadPool pool(threadCount);
+  std::vector<SweepSample> results =
+      BalanceSweep::run(config, spec.parameters, samples, battles, pool);
+
+  if (format == "json") {
+    std::cout << BalanceSweep::toJson(spec.parameters, results) << std::endl;
+  } else {
+    std::cout << BalanceSweep::toCsv(spec.parameters, results);
+  }
+  return 0;
+}
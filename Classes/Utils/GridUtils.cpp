@@ -2,55 +2,46 @@
 
 #include "Manager/Config/ConfigManager.h"
 
-Vec2 GridUtils::gridToScene(float row, float col, const Vec2& p00) {
-  // 从 ConfigManager 获取 deltaX 和 deltaY
+BattleProjection GridUtils::getProjection(const Vec2& p00) {
+  BattleProjection projection;
+  projection.p00 = BattleVec2(p00.x, p00.y);
+
   auto configManager = ConfigManager::getInstance();
   if (!configManager) {
+    CCLOG("ConfigManager not initialized in GridUtils::getProjection");
+    return projection;
+  }
+  auto constantConfig = configManager->getConstantConfig();
+  projection.deltaX = constantConfig.deltaX;
+  projection.deltaY = constantConfig.deltaY;
+  projection.gridSize = constantConfig.gridSize;
+  return projection;
+}
+
+Vec2 GridUtils::gridToScene(float row, float col, const Vec2& p00) {
+  if (!ConfigManager::getInstance()) {
     CCLOG("ConfigManager not initialized in GridUtils::gridToScene");
     return Vec2::ZERO;
   }
-  auto constantConfig = configManager->getConstantConfig();
-  float deltaX = constantConfig.deltaX;
-  float deltaY = constantConfig.deltaY;
 
-  Vec2 pos;
-  pos.x = p00.x + (row + col) * deltaX;
-  pos.y = p00.y + (col - row) * deltaY;
-  return pos;
+  BattleVec2 pos = getProjection(p00).gridToScene(row, col);
+  return Vec2(static_cast<float>(pos.x), static_cast<float>(pos.y));
 }
 
 bool GridUtils::screenToGrid(const Vec2& screenPos, const Vec2& p00, float& row,
                              float& col) {
-  // 从 ConfigManager 获取 deltaX, deltaY 和 gridSize
-  auto configManager = ConfigManager::getInstance();
-  if (!configManager) {
+  if (!ConfigManager::getInstance()) {
     CCLOG("ConfigManager not initialized in GridUtils::screenToGrid");
     return false;
   }
-  auto constantConfig = configManager->getConstantConfig();
-  float deltaX = constantConfig.deltaX;
-  float deltaY = constantConfig.deltaY;
-  int gridSize = constantConfig.gridSize;
-
-  // 从屏幕坐标转换为网格坐标
-  // 使用逆变换公式
-  float dx = screenPos.x - p00.x;
-  float dy = screenPos.y - p00.y;
-
-  // 解方程组：
-  // dx = (row + col) * deltaX
-  // dy = (col - row) * deltaY
-  //
-  // 解得：
-  // col = (dx/deltaX + dy/deltaY) / 2
-  // row = (dx/deltaX - dy/deltaY) / 2
-
-  col = (dx / deltaX + dy / deltaY) / 2.0f;
-  row = (dx / deltaX - dy / deltaY) / 2.0f;
 
-  // 检查是否在有效范围内
-  return (row >= 0.0f && row <= static_cast<float>(gridSize) && col >= 0.0f &&
-          col <= static_cast<float>(gridSize));
+  // 逆变换公式见 BattleProjection::screenToGrid
+  BattleReal gridRow, gridCol;
+  bool valid = getProjection(p00).screenToGrid(
+      BattleVec2(screenPos.x, screenPos.y), gridRow, gridCol);
+  row = static_cast<float>(gridRow);
+  col = static_cast<float>(gridCol);
+  return valid;
 }
 
 bool GridUtils::findNearestGrassVertex(const Vec2& screenPos, const Vec2& p00,
@@ -3,6 +3,7 @@
 
 #include <float.h>
 
+#include "Battle/BattleGrid.h"
 #include "cocos2d.h"
 
 USING_NS_CC;
@@ -14,6 +15,13 @@ USING_NS_CC;
  */
 class GridUtils {
  public:
+  /**
+   * 获取当前配置下的网格投影参数（供无头战斗核心使用）
+   * @param p00 地图原点p[0][0]的位置
+   * @return 网格投影参数
+   */
+  static BattleProjection getProjection(const Vec2& p00);
+
   /**
    * 将网格坐标转换为屏幕坐标（grass顶点位置）
    * @param row 网格行坐标
@@ -10,7 +10,7 @@ USING_NS_CC;
 
 /**
  * 寻路器工具类
- * 实现 A* 寻路算法
+ * 实现 A* 寻路算法（BattlePathFinder 的 cocos2d 包装）
  */
 class PathFinder {
  public:
@@ -0,0 +1,123 @@
+#include <gtest.h>
+
+#include <vector>
+
+#include "Sim/AttackOptimizer.h"
+#include "Sim/SimConfig.h"
+#include "Sim/SimScenario.h"
+#include "Sim/SimThreadPool.h"
+
+namespace {
+const char* kSoldierConfig = R"({
+  "barbarian": {
+    "AttackType": "Any",
+    "SoldierType": "LAND",
+    "1": {"Attack": 40, "Health": 200, "MoveSpeed": 90,
+          "AttackSpeed": 1, "AttackRange": 40}
+  }
+})";
+
+const char* kBuildingConfig = R"({
+  "TownHall": {"type": "TOWN_HALL", "GridSize": 3, "maxLevel": 1,
+               "1": {"health": 300}},
+  "Cannon": {"type": "DEFENSE", "GridSize": 3, "maxLevel": 1,
+             "1": {"health": 300, "damage": 30, "attackSpeed": 1,
+                   "attackRange": 7}}
+})";
+
+const char* kLayout = R"({
+  "TownHall": [{"row": 20, "col": 20, "level": 1}],
+  "Cannon": [{"row": 26, "col": 20, "level": 1}]
+})";
+
+const char* kArmy = R"({
+  "tip": "test army",
+  "troop": [{"Category": "barbarian", "Level": 1, "Count": 4}],
+  "spell": [{"Category": "Heal", "Count": 1}]
+})";
+
+SimConfig makeConfig() {
+  SimConfig config;
+  config.parseSoldierConfig(kSoldierConfig);
+  config.parseBuildingConfig(kBuildingConfig);
+  config.parseSpellConfig(R"({"Heal": {"Category": "DURATION",
+                                       "Duration": 5, "Amount": 50}})");
+  config.setP00(BattleVec2(0, 0));
+  return config;
+}
+
+AttackOptimizerOptions smallOptions() {
+  AttackOptimizerOptions options;
+  options.restarts = 2;
+  options.population = 12;
+  options.generations = 4;
+  options.eliteCount = 2;
+  options.deployWindow = 2.0f;
+  return options;
+}
+}  // namespace
+
+TEST(AttackOptimizerTest, ParsesArmy) {
+  // Arrange
+  SimArmy army;
+
+  // Act
+  bool ok = SimScenario::parseArmy(kArmy, army);
+
+  // Assert
+  ASSERT_TRUE(ok);
+  ASSERT_EQ(army.troops.size(), 1u);
+  EXPECT_EQ(army.troops[0].category, "barbarian");
+  EXPECT_EQ(army.troops[0].count, 4);
+  ASSERT_EQ(army.spells.size(), 1u);
+  EXPECT_EQ(army.spells[0].category, "Heal");
+}
+
+TEST(AttackOptimizerTest, PlanDeploysWholeArmyAndRoundTrips) {
+  // Arrange
+  SimConfig config = makeConfig();
+  std::vector<SimBuildingPlacement> layout;
+  SimScenario::parseLayout(kLayout, layout);
+  SimArmy army;
+  SimScenario::parseArmy(kArmy, army);
+  BattleSimulator simulator(config);
+  AttackOptimizer optimizer(simulator, config.getProjection(), army,
+                            smallOptions());
+  SimThreadPool pool(4);
+
+  // Act
+  AttackPlanResult result = optimizer.optimize(layout, pool);
+  SimRecord reloaded;
+  SimScenario::parseRecord(SimScenario::writeRecord(result.record),
+                           simulator.getTickRate(), reloaded);
+  SimReport replay = simulator.run(layout, reloaded);
+
+  // Assert
+  EXPECT_EQ(optimizer.getUnitCount(), 5);
+  EXPECT_EQ(result.report.deployed, 5);
+  EXPECT_EQ(result.evaluations, 2 * (12 + 4 * 10));
+  EXPECT_GT(result.score, 0.0f);
+  EXPECT_EQ(replay.result.stars, result.report.result.stars);
+  EXPECT_FLOAT_EQ(replay.result.ratio, result.report.result.ratio);
+}
+
+TEST(AttackOptimizerTest, ResultIndependentOfThreadCount) {
+  // Arrange
+  SimConfig config = makeConfig();
+  std::vector<SimBuildingPlacement> layout;
+  SimScenario::parseLayout(kLayout, layout);
+  SimArmy army;
+  SimScenario::parseArmy(kArmy, army);
+  BattleSimulator simulator(config);
+  AttackOptimizer optimizer(simulator, config.getProjection(), army,
+                            smallOptions());
+
+  // Act
+  AttackPlanResult serial = optimizer.optimize(layout, SimThreadPool(1));
+  AttackPlanResult parallel = optimizer.optimize(layout, SimThreadPool(4));
+
+  // Assert
+  EXPECT_EQ(SimScenario::writeRecord(serial.record),
+            SimScenario::writeRecord(parallel.record));
+  EXPECT_FLOAT_EQ(serial.score, parallel.score);
+}
@@ -0,0 +1,187 @@
+#include <gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "Sim/BalanceSweep.h"
+#include "Sim/SimConfig.h"
+#include "Sim/SimThreadPool.h"
+
+namespace {
+const char* kSoldierConfig = R"({
+  "barbarian": {
+    "AttackType": "Any",
+    "SoldierType": "LAND",
+    "1": {"Attack": 40, "Health": 200, "MoveSpeed": 90,
+          "AttackSpeed": 1, "AttackRange": 40},
+    "2": {"Attack": 50, "Health": 250, "MoveSpeed": 90,
+          "AttackSpeed": 1, "AttackRange": 40}
+  }
+})";
+
+const char* kBuildingConfig = R"({
+  "TownHall": {"type": "TOWN_HALL", "GridSize": 3, "maxLevel": 1,
+               "1": {"health": 300}}
+})";
+
+const char* kSpec = R"({
+  "method": "grid",
+  "parameters": [
+    {"config": "soldier", "name": "barbarian", "level": 1,
+     "field": "Attack", "min": 0, "max": 40, "steps": 3},
+    {"config": "building", "name": "TownHall", "field": "health",
+     "min": 100, "max": 200, "steps": 2}
+  ]
+})";
+
+SimConfig makeConfig() {
+  SimConfig config;
+  config.parseSoldierConfig(kSoldierConfig);
+  config.parseBuildingConfig(kBuildingConfig);
+  config.parseSpellConfig("{}");
+  config.setP00(BattleVec2(0, 0));
+  return config;
+}
+
+SweepBattle makeBattle(const SimConfig& config) {
+  SweepBattle battle;
+  SimBuildingPlacement townHall;
+  townHall.name = "TownHall";
+  townHall.row = 20;
+  townHall.col = 20;
+  battle.layout.push_back(townHall);
+
+  BattleVec2 start = config.getProjection().gridToScene(17, 17);
+  SimPlacement barbarian;
+  barbarian.type = "troop";
+  barbarian.category = "barbarian";
+  barbarian.x = static_cast<float>(start.x);
+  barbarian.y = static_cast<float>(start.y);
+  barbarian.tick = 0;
+  battle.record.placements.push_back(barbarian);
+  battle.record.duration = 30;
+  return battle;
+}
+}  // namespace
+
+TEST(BalanceSweepTest, GridCoversEveryCombination) {
+  // Arrange
+  SweepSpec spec;
+  ASSERT_TRUE(BalanceSweep::parseSpec(kSpec, spec));
+
+  // Act
+  std::vector<std::vector<float>> samples = BalanceSweep::makeSamples(spec);
+
+  // Assert
+  ASSERT_EQ(samples.size(), 6u);
+  EXPECT_FLOAT_EQ(samples[0][0], 0.0f);
+  EXPECT_FLOAT_EQ(samples[0][1], 100.0f);
+  EXPECT_FLOAT_EQ(samples[3][0], 20.0f);
+  EXPECT_FLOAT_EQ(samples[3][1], 200.0f);
+  EXPECT_FLOAT_EQ(samples[5][0], 40.0f);
+  EXPECT_EQ(spec.parameters[1].label(), "building.TownHall.all.health");
+}
+
+TEST(BalanceSweepTest, LatinHypercubeHitsEveryStratum) {
+  // Arrange
+  std::vector<SweepParameter> parameters(2);
+  parameters[0].max = 1.0f;
+  parameters[1].min = 10.0f;
+  parameters[1].max = 20.0f;
+
+  // Act
+  std::vector<std::vector<float>> samples =
+      BalanceSweep::latinHypercubeSamples(parameters, 8, 42);
+
+  // Assert
+  ASSERT_EQ(samples.size(), 8u);
+  for (size_t p = 0; p < parameters.size(); ++p) {
+    std::vector<int> hits(8, 0);
+    for (const std::vector<float>& sample : samples) {
+      float t = (sample[p] - parameters[p].min) /
+                (parameters[p].max - parameters[p].min);
+      hits[std::min(static_cast<int>(t * 8), 7)]++;
+    }
+    for (int count : hits) {
+      EXPECT_EQ(count, 1);
+    }
+  }
+}
+
+TEST(BalanceSweepTest, OverridesOnlyTargetLevel) {
+  // Arrange
+  SimConfig config = makeConfig();
+  SweepSpec spec;
+  BalanceSweep::parseSpec(kSpec, spec);
+
+  // Act
+  bool ok = BalanceSweep::applyValues(spec.parameters, {25.0f, 150.0f},
+                                      config);
+  bool unknown = config.setSoldierValue("barbarian", 1, "Armor", 1.0f);
+
+  // Assert
+  EXPECT_TRUE(ok);
+  EXPECT_FALSE(unknown);
+  EXPECT_FLOAT_EQ(config.findSoldierConfig("barbarian", 1)->attack, 25.0f);
+  EXPECT_FLOAT_EQ(config.findSoldierConfig("barbarian", 2)->attack, 50.0f);
+  EXPECT_FLOAT_EQ(config.findBuildingConfig("TownHall", 1)->maxHP, 150.0f);
+}
+
+TEST(BalanceSweepTest, WinRateFollowsOverride) {
+  // Arrange
+  SimConfig config = makeConfig();
+  SweepSpec spec;
+  BalanceSweep::parseSpec(kSpec, spec);
+  std::vector<std::vector<float>> samples = BalanceSweep::makeSamples(spec);
+  std::vector<SweepBattle> battles(2, makeBattle(config));
+  SimThreadPool pool(3);
+
+  // Act
+  std::vector<SweepSample> results = BalanceSweep::run(
+      config, spec.parameters, samples, battles, pool);
+
+  // Assert
+  ASSERT_EQ(results.size(), samples.size());
+  EXPECT_EQ(results[0].battles, 2);
+  EXPECT_EQ(results[0].wins, 0);
+  EXPECT_EQ(results[5].wins, 2);
+  EXPECT_FLOAT_EQ(results[5].ratio, 1.0f);
+}
+
+TEST(BalanceSweepTest, DefenseRangeOverrideReachesBattle) {
+  // Arrange: a cannon about 19 grids (570 px) from the barbarian, its range
+  // swept from 1 to 30 grids
+  SimConfig config = makeConfig();
+  config.parseBuildingConfig(R"({
+    "TownHall": {"type": "TOWN_HALL", "GridSize": 3, "maxLevel": 1,
+                 "1": {"health": 300}},
+    "Cannon": {"type": "DEFENSE", "GridSize": 3, "maxLevel": 1,
+               "1": {"health": 300, "damage": 500, "attackSpeed": 1,
+                     "attackRange": 7}}
+  })");
+  SweepSpec spec;
+  ASSERT_TRUE(BalanceSweep::parseSpec(R"({
+    "method": "grid",
+    "parameters": [
+      {"config": "building", "name": "Cannon", "field": "attackRange",
+       "min": 1, "max": 30, "steps": 2}
+    ]
+  })", spec));
+  SweepBattle battle = makeBattle(config);
+  SimBuildingPlacement cannon;
+  cannon.name = "Cannon";
+  cannon.row = 28;
+  cannon.col = 10;
+  battle.layout.push_back(cannon);
+  SimThreadPool pool(2);
+
+  // Act
+  std::vector<SweepSample> results = BalanceSweep::run(
+      config, spec.parameters, BalanceSweep::makeSamples(spec), {battle},
+      pool);
+
+  // Assert: only the long-range cannon stops the town hall from falling
+  ASSERT_EQ(results.size(), 2u);
+  EXPECT_GT(results[0].ratio, 0.0f);
+  EXPECT_FLOAT_EQ(results[1].ratio, 0.0f);
+}
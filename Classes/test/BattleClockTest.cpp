@@ -0,0 +1,125 @@
+#include <gtest.h>
+
+#include "Battle/BattleClock.h"
+#include "Battle/BattleWorld.h"
+#include "test/BattleTestUtils.h"
+
+namespace {
+int runFrames(BattleClock& clock, float frameDelta, int frames) {
+  int ticks = 0;
+  for (int i = 0; i < frames; ++i) {
+    clock.beginFrame(frameDelta);
+    while (clock.consumeTick()) {
+      ticks++;
+    }
+  }
+  return ticks;
+}
+
+BattleWorld makeWorld() {
+  BattleProjection projection = makeProjection();
+  BattleWorld world(projection);
+  world.addBuilding("Cannon", 1, makeDefenseStats(400.0f, 8), 20, 20);
+  world.addSoldier(SoldierType::BARBARIAN, 1,
+                   makeSoldierStats(100.0f, 20.0f, 90.0f),
+                   projection.gridToScene(12, 14));
+  return world;
+}
+
+void simulateTicks(BattleWorld& world, float frameDelta, int ticks) {
+  BattleClock clock;
+  while (clock.getTick() < ticks) {
+    clock.beginFrame(frameDelta);
+    while (clock.getTick() < ticks && clock.consumeTick()) {
+      world.update(clock.getTickDelta());
+    }
+  }
+}
+}  // namespace
+
+TEST(BattleClockTest, TickCountIndependentOfFrameRate) {
+  // Arrange
+  BattleClock clock60(30);
+  BattleClock clock20(30);
+
+  // Act
+  runFrames(clock60, 1.0f / 60.0f, 120);
+  runFrames(clock20, 1.0f / 20.0f, 40);
+
+  // Assert
+  EXPECT_NEAR(clock60.getTick(), 60, 1);
+  EXPECT_NEAR(clock20.getTick(), 60, 1);
+  EXPECT_NEAR(clock60.getElapsed(), 2.0f, 1.0f / 30.0f);
+}
+
+TEST(BattleClockTest, SpeedRunsSeveralTicksPerFrame) {
+  // Arrange
+  BattleClock clock(30);
+  clock.setSpeed(4);
+
+  // Act
+  clock.beginFrame(1.0f / 30.0f);
+  int ticks = 0;
+  while (clock.consumeTick()) {
+    ticks++;
+  }
+
+  // Assert
+  EXPECT_EQ(clock.getSpeed(), 4);
+  EXPECT_GE(ticks, 3);
+  EXPECT_LE(ticks, 4);
+}
+
+TEST(BattleClockTest, InvalidSpeedFallsBackToNormal) {
+  // Arrange
+  BattleClock clock;
+
+  // Act
+  clock.setSpeed(3);
+
+  // Assert
+  EXPECT_EQ(clock.getSpeed(), 1);
+}
+
+TEST(BattleClockTest, AlphaIsFractionOfPendingTick) {
+  // Arrange
+  BattleClock clock(10);
+
+  // Act
+  clock.beginFrame(0.25f);
+  while (clock.consumeTick()) {
+  }
+
+  // Assert
+  EXPECT_EQ(clock.getTick(), 2);
+  EXPECT_NEAR(clock.getAlpha(), 0.5f, 1e-4f);
+}
+
+TEST(BattleClockTest, LongFrameIsClamped) {
+  // Arrange
+  BattleClock clock(30);
+
+  // Act
+  int ticks = runFrames(clock, 5.0f, 1);
+
+  // Assert
+  EXPECT_LE(ticks, 8);
+}
+
+TEST(BattleClockTest, WorldOutcomeIndependentOfFrameRate) {
+  // Arrange
+  BattleWorld smooth = makeWorld();
+  BattleWorld choppy = makeWorld();
+
+  // Act
+  simulateTicks(smooth, 1.0f / 144.0f, 300);
+  simulateTicks(choppy, 1.0f / 24.0f, 300);
+
+  // Assert
+  const BattleSoldierArray& a = smooth.getSoldiers();
+  const BattleSoldierArray& b = choppy.getSoldiers();
+  EXPECT_EQ(a.hp[0], b.hp[0]);
+  EXPECT_EQ(a.x[0], b.x[0]);
+  EXPECT_EQ(a.y[0], b.y[0]);
+  EXPECT_EQ(smooth.getBuildings()[0].hp, choppy.getBuildings()[0].hp);
+}
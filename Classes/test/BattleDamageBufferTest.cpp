@@ -0,0 +1,85 @@
+#include <gtest.h>
+
+#include <vector>
+
+#include "Battle/BattleDamageBuffer.h"
+#include "Battle/BattleWorld.h"
+#include "test/BattleTestUtils.h"
+
+namespace {
+const BattleBuildingStats kCannon = makeDefenseStats(1000.0f, 60);
+const BattleSoldierStats kSoldier = makeSoldierStats(100.0f, 10.0f, 0.0f);
+}  // namespace
+
+TEST(BattleDamageBufferTest, DrainSumsPerTargetInIdOrder) {
+  // Arrange
+  BattleDamageBuffer buffer;
+  buffer.addBuildingDamage(3, 10.0f);
+  buffer.addBuildingDamage(1, 5.0f);
+  buffer.addBuildingDamage(3, 7.0f);
+  buffer.addSoldierDamage(2, 1.0f);
+  std::vector<BattleDamageEvent> totals;
+
+  // Act
+  buffer.drainBuildings(totals);
+
+  // Assert
+  ASSERT_EQ(totals.size(), 2u);
+  EXPECT_EQ(totals[0].target, 1);
+  EXPECT_FLOAT_EQ(static_cast<float>(totals[0].amount), 5.0f);
+  EXPECT_EQ(totals[1].target, 3);
+  EXPECT_FLOAT_EQ(static_cast<float>(totals[1].amount), 17.0f);
+  EXPECT_FALSE(buffer.empty());
+  buffer.drainSoldiers(totals);
+  EXPECT_TRUE(buffer.empty());
+}
+
+TEST(BattleDamageBufferTest, SameTickShotsResolveTogether) {
+  // Arrange: two cannons fire at the same soldier in the same tick
+  BattleWorld world(makeProjection());
+  int first = world.addBuilding("Cannon", 1, kCannon, 20, 20);
+  world.addBuilding("Cannon", 1, kCannon, 20, 24);
+  BattleVec2 pos = world.getBuildings()[first].position;
+  world.addSoldier(SoldierType::BARBARIAN, 1, kSoldier,
+                   BattleVec2(pos.x + 60.0f, pos.y + 60.0f));
+  world.addSoldier(SoldierType::BARBARIAN, 1, kSoldier,
+                   BattleVec2(pos.x + 60.0f, pos.y - 600.0f));
+
+  // Act
+  world.update(1.0f / 30.0f);
+
+  // Assert
+  const BattleDamageReport& report = world.getDamageReport();
+  EXPECT_FALSE(world.getSoldiers().isAlive(0));
+  EXPECT_TRUE(world.getSoldiers().isAlive(1));
+  ASSERT_EQ(report.killedSoldiers.size(), 1u);
+  EXPECT_EQ(report.killedSoldiers[0], 0);
+}
+
+TEST(BattleDamageBufferTest, ReportListsDestroyedBuildingOnce) {
+  // Arrange
+  BattleWorld world(makeProjection());
+  BattleBuildingStats mine;
+  mine.type = BuildingType::RESOURCE;
+  mine.gridCount = 3;
+  mine.maxHP = 15.0f;
+  int building = world.addBuilding("GoldMine", 1, mine, 20, 20);
+  BattleVec2 pos = world.getBuildings()[building].position;
+  for (int i = 0; i < 3; ++i) {
+    world.addSoldier(SoldierType::BARBARIAN, 1, kSoldier, pos);
+  }
+
+  // Act: first tick acquires the target, second tick attacks
+  world.update(1.0f / 30.0f);
+  world.update(1.0f / 30.0f);
+
+  // Assert
+  const BattleDamageReport& report = world.getDamageReport();
+  ASSERT_EQ(report.destroyedBuildings.size(), 1u);
+  EXPECT_EQ(report.destroyedBuildings[0], building);
+  EXPECT_EQ(report.damagedBuildings.size(), 1u);
+  EXPECT_TRUE(world.getGrid().isWalkable(20, 20));
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(world.getSoldiers().state[i], SoldierState::IDLE);
+  }
+}
@@ -0,0 +1,83 @@
+#include <gtest.h>
+
+#include "Battle/BattleFixed.h"
+
+TEST(BattleFixedTest, ArithmeticMatchesExpectedValues) {
+  // Arrange
+  BattleFixed a(2.5f);
+  BattleFixed b(-1.25f);
+
+  // Act
+  BattleFixed sum = a + b;
+  BattleFixed product = a * b;
+  BattleFixed quotient = a / b;
+
+  // Assert
+  EXPECT_EQ(sum, BattleFixed(1.25f));
+  EXPECT_EQ(product, BattleFixed(-3.125f));
+  EXPECT_EQ(quotient, BattleFixed(-2));
+}
+
+TEST(BattleFixedTest, SqrtIsExactForPerfectSquares) {
+  // Arrange
+  BattleFixed value(144);
+
+  // Act
+  BattleFixed root = BattleFixed::sqrt(value);
+
+  // Assert
+  EXPECT_EQ(root, BattleFixed(12));
+  EXPECT_EQ(BattleFixed::sqrt(BattleFixed(-4)), BattleFixed(0));
+}
+
+TEST(BattleFixedTest, SqrtHasKnownRawResult) {
+  // Arrange
+  BattleFixed two(2);
+
+  // Act
+  BattleFixed root = BattleFixed::sqrt(two);
+
+  // Assert
+  // floor(sqrt(2) * 65536) on every platform
+  EXPECT_EQ(root.raw(), 92681);
+}
+
+TEST(BattleFixedTest, HypotHandlesLargeCoordinates) {
+  // Arrange
+  BattleFixed x(3000);
+  BattleFixed y(4000);
+
+  // Act
+  BattleFixed length = BattleFixed::hypot(x, y);
+
+  // Assert
+  // x * x overflows Q16.16, so the intermediate must be 64-bit
+  EXPECT_EQ(length, BattleFixed(5000));
+}
+
+TEST(BattleFixedTest, DivideByZeroSaturates) {
+  // Arrange
+  BattleFixed one(1);
+  BattleFixed zero;
+
+  // Act
+  BattleFixed positive = one / zero;
+  BattleFixed negative = -one / zero;
+
+  // Assert
+  EXPECT_EQ(positive, BattleFixed::max());
+  EXPECT_EQ(negative, BattleFixed::lowest());
+}
+
+TEST(BattleFixedTest, ConversionsRoundTrip) {
+  // Arrange
+  BattleFixed value(-7.75f);
+
+  // Act
+  float asFloat = static_cast<float>(value);
+  int asInt = static_cast<int>(value);
+
+  // Assert
+  EXPECT_FLOAT_EQ(asFloat, -7.75f);
+  EXPECT_EQ(asInt, -7);
+}
@@ -0,0 +1,171 @@
+#include <gtest.h>
+
+#include <vector>
+
+#include "Battle/BattleFlowField.h"
+#include "Battle/BattlePathFinder.h"
+#include "test/BattleTestUtils.h"
+
+TEST(BattleFlowFieldTest, PathDetoursAroundBlockedArea) {
+  // Arrange: a wall across column 10 with a gap at row 18
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  for (int row = 0; row < 18; ++row) {
+    grid.setArea(row, 10, 1, true);
+  }
+  BattleVec2 start = projection.gridToScene(2.5f, 2.5f);
+  BattleVec2 end = projection.gridToScene(2.5f, 17.5f);
+  BattleFlowField field;
+
+  // Act
+  bool built = field.build(end, projection, grid, 4);
+  std::vector<BattleVec2> path = field.tracePath(start, projection);
+
+  // Assert
+  ASSERT_TRUE(built);
+  ASSERT_FALSE(path.empty());
+  bool passedGap = false;
+  for (const BattleVec2& point : path) {
+    BattleReal row, col;
+    ASSERT_TRUE(projection.screenToGrid(point, row, col));
+    EXPECT_TRUE(grid.isWalkable(static_cast<int>(row), static_cast<int>(col)));
+    passedGap = passedGap || row >= 18.0f;
+  }
+  EXPECT_TRUE(passedGap);
+  EXPECT_LT(path.back().distance(end), projection.gridPixelLength() / 4);
+}
+
+TEST(BattleFlowFieldTest, PathIsNoLongerThanAStar) {
+  // Arrange: a building in the middle, approached from two sides
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  grid.setArea(10, 10, 3, true);
+  BattleVec2 target = projection.gridToScene(10.0f, 10.0f);
+  BattleFlowField field;
+  ASSERT_TRUE(field.build(target, projection, grid, 4));
+
+  for (BattleReal startRow : {2.0f, 17.0f}) {
+    BattleVec2 start = projection.gridToScene(startRow, 3.0f);
+
+    // Act
+    std::vector<BattleVec2> traced = field.tracePath(start, projection);
+    std::vector<BattleVec2> searched =
+        BattlePathFinder::findPath(start, target, projection, grid, 4);
+
+    // Assert: the field gives exact costs, so its path is never longer
+    // than the one found by A* with its Manhattan heuristic
+    ASSERT_FALSE(traced.empty());
+    ASSERT_FALSE(searched.empty());
+    BattleReal tracedLength = start.distance(traced.front());
+    for (size_t i = 1; i < traced.size(); ++i) {
+      tracedLength += traced[i - 1].distance(traced[i]);
+    }
+    BattleReal searchedLength = start.distance(searched.front());
+    for (size_t i = 1; i < searched.size(); ++i) {
+      searchedLength += searched[i - 1].distance(searched[i]);
+    }
+    EXPECT_LE(static_cast<float>(tracedLength),
+              static_cast<float>(searchedLength) + 1.0f);
+  }
+}
+
+TEST(BattleFlowFieldTest, EnclosedTargetIsUnreachable) {
+  // Arrange: the whole map except the start area is blocked
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  grid.setArea(10, 10, 20, true);
+  grid.setArea(1, 1, 2, false);
+  BattleVec2 start = projection.gridToScene(1.0f, 1.0f);
+  BattleVec2 end = projection.gridToScene(15.0f, 15.0f);
+  BattleFlowField field;
+
+  // Act
+  bool built = field.build(end, projection, grid, 2);
+  std::vector<BattleVec2> path = field.tracePath(start, projection);
+
+  // Assert
+  EXPECT_FALSE(built);
+  EXPECT_TRUE(path.empty());
+}
+
+TEST(BattleFlowFieldTest, GridVersionChangesOnEdit) {
+  // Arrange
+  BattleGrid grid(10);
+  unsigned before = grid.getVersion();
+
+  // Act
+  grid.setArea(5, 5, 1, true);
+  unsigned afterSet = grid.getVersion();
+  grid.clear();
+
+  // Assert
+  EXPECT_NE(before, afterSet);
+  EXPECT_NE(afterSet, grid.getVersion());
+}
+
+TEST(BattleFlowFieldTest, RepairAfterWallBreakMatchesRebuild) {
+  // Arrange: a wall across column 10 with a gap at row 18, and a target
+  // building on the far side
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  for (int row = 0; row < 18; ++row) {
+    grid.setArea(row, 10, 1, true);
+  }
+  grid.setArea(4, 15, 3, true);
+  BattleVec2 target = projection.gridToScene(4.0f, 15.0f);
+  BattleFlowField repaired;
+  ASSERT_TRUE(repaired.build(target, projection, grid, 4));
+
+  // Act: the wall segment next to the gap is destroyed
+  grid.setArea(17, 10, 1, false);
+  std::vector<BattleGridArea> areas = {BattleGridArea::around(17, 10, 1)};
+  bool ok = repaired.repair(grid, areas);
+  BattleFlowField rebuilt;
+  ASSERT_TRUE(rebuilt.build(target, projection, grid, 4));
+
+  // Assert: same costs everywhere; only cells whose cost dropped are
+  // visited again
+  ASSERT_TRUE(ok);
+  for (int row = 0; row < rebuilt.getSize(); ++row) {
+    for (int col = 0; col < rebuilt.getSize(); ++col) {
+      ASSERT_EQ(repaired.getCost(row, col), rebuilt.getCost(row, col));
+    }
+  }
+  EXPECT_LT(repaired.getLastVisitedCount(), rebuilt.getLastVisitedCount());
+}
+
+TEST(BattleFlowFieldTest, RepairOfLocalChangeVisitsFewCells) {
+  // Arrange: a building in the corner, away from every shortest path
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  grid.setArea(2, 2, 3, true);
+  BattleVec2 target = projection.gridToScene(15.0f, 15.0f);
+  BattleFlowField field;
+  ASSERT_TRUE(field.build(target, projection, grid, 4));
+  int fullCount = field.getLastVisitedCount();
+
+  // Act
+  grid.setArea(2, 2, 3, false);
+  bool ok = field.repair(grid, {BattleGridArea::around(2, 2, 3)});
+
+  // Assert
+  ASSERT_TRUE(ok);
+  EXPECT_LT(field.getLastVisitedCount(), fullCount / 10);
+  EXPECT_NE(field.getCost(8, 8), BattleFlowField::UNREACHABLE);
+}
+
+TEST(BattleFlowFieldTest, RepairRejectsNewlyBlockedCells) {
+  // Arrange
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  BattleFlowField field;
+  ASSERT_TRUE(field.build(projection.gridToScene(10.0f, 10.0f), projection,
+                          grid, 4));
+
+  // Act
+  grid.setArea(5, 5, 2, true);
+  bool ok = field.repair(grid, {BattleGridArea::around(5, 5, 2)});
+
+  // Assert: costs around the new building may rise, so rebuild instead
+  EXPECT_FALSE(ok);
+}
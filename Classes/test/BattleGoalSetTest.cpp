@@ -0,0 +1,136 @@
+#include <gtest.h>
+
+#include <vector>
+
+#include "Battle/BattleFlowField.h"
+#include "Battle/BattleGoalSet.h"
+#include "Battle/BattlePathFinder.h"
+#include "test/BattleTestUtils.h"
+
+namespace {
+// A 3x3 building at (15, 15) inside a closed ring of walls two cells away
+BattleGrid makeWalledGrid(const BattleProjection& projection) {
+  BattleGrid grid(projection.gridSize);
+  grid.setArea(15, 15, 3, true);
+  for (int i = 12; i <= 18; ++i) {
+    grid.setArea(12, i, 1, true);
+    grid.setArea(18, i, 1, true);
+    grid.setArea(i, 12, 1, true);
+    grid.setArea(i, 18, 1, true);
+  }
+  return grid;
+}
+
+bool endsInRange(const std::vector<BattleVec2>& path,
+                 const BattleProjection& projection, BattleReal range) {
+  BattleReal row, col;
+  return !path.empty() && projection.screenToGrid(path.back(), row, col) &&
+         BattleGoalSet::isInRange(path.back(), row, col, 15, 15, 3, range,
+                                  projection);
+}
+}  // namespace
+
+TEST(BattleGoalSetTest, CellsMatchRangeCheckAtCellCentres) {
+  // Arrange
+  BattleProjection projection = makeProjection(30);
+  BattleGrid grid(projection.gridSize);
+  grid.setArea(15, 15, 3, true);
+  const int precision = 4;
+
+  // Act
+  BattleGoalSet goals;
+  bool found = goals.build(15, 15, 3, 90.0f, projection, grid, precision);
+
+  // Assert: the bounded scan agrees with a scan of the whole map
+  ASSERT_TRUE(found);
+  const int size = goals.getSize();
+  int expected = 0;
+  for (int r = 0; r < size; ++r) {
+    for (int c = 0; c < size; ++c) {
+      BattleReal row = (BattleReal(r) + 0.5f) / precision;
+      BattleReal col = (BattleReal(c) + 0.5f) / precision;
+      bool inRange =
+          grid.isWalkable(r / precision, c / precision) &&
+          BattleGoalSet::isInRange(projection.gridToScene(row, col), row, col,
+                                   15, 15, 3, 90.0f, projection);
+      EXPECT_EQ(goals.contains(r * size + c), inRange);
+      expected += inRange ? 1 : 0;
+    }
+  }
+  EXPECT_EQ(static_cast<int>(goals.getCells().size()), expected);
+}
+
+TEST(BattleGoalSetTest, OnlyRangedGoalsAreReachableOverWalls) {
+  // Arrange
+  BattleProjection projection = makeProjection(30);
+  BattleGrid grid = makeWalledGrid(projection);
+  BattleGoalSet melee;
+  BattleGoalSet ranged;
+  melee.build(15, 15, 3, 40.0f, projection, grid, 4);
+  ranged.build(15, 15, 3, 200.0f, projection, grid, 4);
+  BattleVec2 start = projection.gridToScene(3.0f, 4.0f);
+
+  // Act
+  BattleFlowField meleeField;
+  BattleFlowField rangedField;
+  meleeField.build(melee, grid);
+  rangedField.build(ranged, grid);
+
+  // Assert: melee goals all lie inside the ring
+  ASSERT_FALSE(melee.empty());
+  for (int cell : melee.getCells()) {
+    int row = cell / melee.getSize() / 4;
+    int col = cell % melee.getSize() / 4;
+    EXPECT_TRUE(row > 12 && row < 18 && col > 12 && col < 18);
+  }
+  EXPECT_TRUE(meleeField.tracePath(start, projection).empty());
+  EXPECT_FALSE(rangedField.tracePath(start, projection).empty());
+}
+
+TEST(BattleGoalSetTest, SearchesStopWhereTheTargetIsInRange) {
+  // Arrange
+  BattleProjection projection = makeProjection(30);
+  BattleGrid grid = makeWalledGrid(projection);
+  BattleGoalSet goals;
+  ASSERT_TRUE(goals.build(15, 15, 3, 200.0f, projection, grid, 4));
+  BattleVec2 start = projection.gridToScene(3.0f, 4.0f);
+  BattleVec2 target = projection.gridToScene(15.0f, 15.0f);
+
+  // Act
+  BattleFlowField field;
+  bool built = field.build(goals, grid);
+  std::vector<BattleVec2> traced = field.tracePath(start, projection);
+  std::vector<BattleVec2> searched =
+      BattlePathFinder::findPath(start, target, goals, projection, grid);
+
+  // Assert: both stop outside the ring, where the building is in range
+  ASSERT_TRUE(built);
+  EXPECT_TRUE(endsInRange(traced, projection, 200.0f));
+  EXPECT_TRUE(endsInRange(searched, projection, 200.0f));
+}
+
+TEST(BattleGoalSetTest, RepairUsesRefreshedGoals) {
+  // Arrange: destroying a wall segment opens goal cells next to it
+  BattleProjection projection = makeProjection(30);
+  BattleGrid grid = makeWalledGrid(projection);
+  BattleGoalSet goals;
+  goals.build(15, 15, 3, 200.0f, projection, grid, 4);
+  BattleFlowField repaired;
+  ASSERT_TRUE(repaired.build(goals, grid));
+
+  // Act
+  grid.setArea(12, 15, 1, false);
+  std::vector<BattleGridArea> areas(1, BattleGridArea::around(12, 15, 1));
+  goals.build(15, 15, 3, 200.0f, projection, grid, 4);
+  bool ok = repaired.repair(grid, areas, goals);
+  BattleFlowField rebuilt;
+  rebuilt.build(goals, grid);
+
+  // Assert
+  ASSERT_TRUE(ok);
+  for (int r = 0; r < rebuilt.getSize(); ++r) {
+    for (int c = 0; c < rebuilt.getSize(); ++c) {
+      EXPECT_EQ(repaired.getCost(r, c), rebuilt.getCost(r, c));
+    }
+  }
+}
@@ -0,0 +1,83 @@
+#include <gtest.h>
+
+#include "Battle/BattleHandle.h"
+#include "Battle/BattleWorld.h"
+#include "test/BattleTestUtils.h"
+
+namespace {
+const BattleBuildingStats kCannon = makeDefenseStats(1000.0f, 60);
+const BattleSoldierStats kSoldier = makeSoldierStats(50.0f, 10.0f, 0.0f);
+}  // namespace
+
+TEST(BattleHandleTest, ReleasedHandleIsStaleAfterReuse) {
+  // Arrange
+  BattleHandleRegistry registry;
+  BattleHandle first = registry.allocate();
+  BattleHandle second = registry.allocate();
+
+  // Act
+  registry.release(first);
+  BattleHandle reused = registry.allocate();
+
+  // Assert
+  EXPECT_EQ(reused.index(), first.index());
+  EXPECT_NE(reused, first);
+  EXPECT_FALSE(registry.isValid(first));
+  EXPECT_TRUE(registry.isValid(reused));
+  EXPECT_TRUE(registry.isValid(second));
+  EXPECT_FALSE(registry.isValid(BattleHandle()));
+  EXPECT_EQ(registry.capacity(), 2);
+}
+
+TEST(BattleHandleTest, ClearInvalidatesAndReusesFromLowestSlot) {
+  // Arrange
+  BattleHandleRegistry registry;
+  BattleHandle first = registry.allocate();
+  registry.allocate();
+  registry.allocate();
+
+  // Act
+  registry.clear();
+  BattleHandle next = registry.allocate();
+
+  // Assert
+  EXPECT_FALSE(registry.isValid(first));
+  EXPECT_EQ(next.index(), 0);
+  EXPECT_TRUE(registry.isValid(next));
+  EXPECT_EQ(registry.capacity(), 3);
+}
+
+TEST(BattleHandleTest, DeadSoldierSlotIsReusedWithoutInheritingRage) {
+  // Arrange: a raged soldier dies next to a cannon
+  BattleWorld world(makeProjection());
+  int cannon = world.addBuilding("Cannon", 1, kCannon, 20, 20);
+  BattleVec2 pos = world.getBuildings()[cannon].position;
+  BattleVec2 nearPos(pos.x + 60.0f, pos.y + 60.0f);
+  int dead = world.addSoldier(SoldierType::BARBARIAN, 1, kSoldier,
+                              nearPos);
+  BattleHandle stale = world.getSoldierHandle(dead);
+  BattleSpellStats rage;
+  rage.category = SpellCategory::DURATION;
+  rage.duration = 1.0f;
+  rage.radius = 100.0f;
+  rage.ratio = 2.0f;
+  world.castSpell(SpellType::RAGE, rage, nearPos);
+  world.update(1.0f / 30.0f);
+  ASSERT_FALSE(world.getSoldiers().isAlive(dead));
+
+  // Act: a new soldier outside the rage radius takes over the slot
+  int reused = world.addSoldier(SoldierType::BARBARIAN, 1, kSoldier,
+                                BattleVec2(pos.x + 60.0f, pos.y - 600.0f));
+  for (int i = 0; i < 45; ++i) {
+    world.update(1.0f / 30.0f);
+  }
+
+  // Assert
+  EXPECT_EQ(reused, dead);
+  EXPECT_EQ(world.getSoldiers().size(), 1);
+  EXPECT_FALSE(world.isSoldierValid(stale));
+  EXPECT_TRUE(world.isSoldierValid(world.getSoldierHandle(reused)));
+  EXPECT_FLOAT_EQ(static_cast<float>(world.getSoldiers().attackDamage[reused]),
+                  10.0f);
+  EXPECT_FALSE(world.getSpells()[0].active);
+}
@@ -0,0 +1,141 @@
+#include <gtest.h>
+
+#include <vector>
+
+#include "Battle/BattlePathCache.h"
+#include "test/BattleTestUtils.h"
+
+namespace {
+const int kRange = 40;
+
+BattleVec2 cellCentre(const BattleProjection& projection, int row, int col) {
+  return projection.gridToScene(row + 0.5f, col + 0.5f);
+}
+
+// A straight path along one row, through cell centres
+std::vector<BattleVec2> rowPath(const BattleProjection& projection, int row,
+                                int fromCol, int toCol) {
+  std::vector<BattleVec2> path;
+  for (int col = fromCol; col <= toCol; ++col) {
+    path.push_back(cellCentre(projection, row, col));
+  }
+  return path;
+}
+}  // namespace
+
+TEST(BattlePathCacheTest, HitRequiresSameKeyAndVersion) {
+  // Arrange
+  BattleProjection projection = makeProjection(20);
+  BattlePathCache cache;
+  std::vector<BattleVec2> path = rowPath(projection, 2, 2, 8);
+  BattleGridArea goal = BattleGridArea::around(2, 10, 3).expanded(3);
+
+  // Act
+  cache.store(7, 1, false, kRange, 5, path[0], path, projection, goal);
+
+  // Assert
+  const std::vector<BattleVec2>* found = cache.find(7, 1, false, kRange, 5);
+  ASSERT_NE(found, nullptr);
+  EXPECT_EQ(found->size(), path.size());
+  EXPECT_EQ(cache.find(7, 1, true, kRange, 5), nullptr);
+  EXPECT_EQ(cache.find(7, 2, false, kRange, 5), nullptr);
+  EXPECT_EQ(cache.find(8, 1, false, kRange, 5), nullptr);
+  EXPECT_EQ(cache.find(7, 1, false, kRange, 6), nullptr);
+  EXPECT_EQ(cache.find(7, 1, false, kRange + 60, 5), nullptr);
+}
+
+TEST(BattlePathCacheTest, InvalidateDropsOnlyIntersectingEntries) {
+  // Arrange: one path crosses the changed area, one passes far from it,
+  // and one has its goal ring next to it
+  BattleProjection projection = makeProjection(20);
+  BattlePathCache cache;
+  BattleGridArea farGoal = BattleGridArea::around(2, 18, 1).expanded(3);
+  cache.store(1, 1, false, kRange, 3, cellCentre(projection, 10, 0),
+              rowPath(projection, 10, 0, 15), projection, farGoal);
+  cache.store(2, 1, false, kRange, 3, cellCentre(projection, 2, 0),
+              rowPath(projection, 2, 0, 15), projection, farGoal);
+  BattleGridArea nearGoal = BattleGridArea::around(14, 5, 2).expanded(3);
+  cache.store(3, 2, false, kRange, 3, cellCentre(projection, 18, 0),
+              rowPath(projection, 18, 0, 1), projection, nearGoal);
+
+  // Act: a 2x2 building at (10, 5) is destroyed
+  cache.invalidate(BattleGridArea::around(10, 5, 2), false, 3, 4);
+
+  // Assert
+  EXPECT_EQ(cache.find(1, 1, false, kRange, 4), nullptr);
+  EXPECT_NE(cache.find(2, 1, false, kRange, 4), nullptr);
+  EXPECT_EQ(cache.find(3, 2, false, kRange, 4), nullptr);
+  EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST(BattlePathCacheTest, MissedChangeClearsEverything) {
+  // Arrange
+  BattleProjection projection = makeProjection(20);
+  BattlePathCache cache;
+  BattleGridArea goal = BattleGridArea::around(2, 18, 1).expanded(3);
+  cache.store(1, 1, false, kRange, 3, cellCentre(projection, 2, 0),
+              rowPath(projection, 2, 0, 5), projection, goal);
+
+  // Act: the change from version 3 to 4 was never reported
+  cache.invalidate(BattleGridArea::around(15, 15, 1), false, 4, 5);
+
+  // Assert
+  EXPECT_EQ(cache.size(), 0u);
+  EXPECT_EQ(cache.find(1, 1, false, kRange, 5), nullptr);
+}
+
+TEST(BattlePathCacheTest, EraseBuildingRemovesItsEntries) {
+  // Arrange
+  BattleProjection projection = makeProjection(20);
+  BattlePathCache cache;
+  BattleGridArea goal = BattleGridArea::around(2, 18, 1).expanded(3);
+  cache.store(1, 1, false, kRange, 0, cellCentre(projection, 2, 0),
+              rowPath(projection, 2, 0, 5), projection, goal);
+  cache.store(1, 1, true, kRange, 0, cellCentre(projection, 2, 0),
+              rowPath(projection, 2, 0, 5), projection, goal);
+  cache.store(1, 2, false, kRange, 0, cellCentre(projection, 2, 0),
+              rowPath(projection, 2, 0, 5), projection, goal);
+
+  // Act
+  cache.eraseBuilding(1);
+
+  // Assert
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_NE(cache.find(1, 2, false, kRange, 0), nullptr);
+}
+
+TEST(BattlePathCacheTest, SmoothedSegmentsRecordEveryCrossedCell) {
+  // Arrange: a smoothed path keeps only its corners, one diagonal segment
+  BattleProjection projection = makeProjection(20);
+  BattlePathCache cache;
+  BattleGridArea goal = BattleGridArea::around(18, 18, 1).expanded(1);
+  std::vector<BattleVec2> path(1, cellCentre(projection, 12, 12));
+  cache.store(1, 1, false, kRange, 0, cellCentre(projection, 2, 2), path,
+              projection, goal);
+
+  // Act: an obstacle appears on the diagonal, far from both end points
+  cache.invalidate(BattleGridArea::around(7, 7, 1), true, 0, 1);
+
+  // Assert
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(BattlePathCacheTest, OpeningInsideBoundsDropsDetour) {
+  // Arrange: a detour along row 2, then down to a goal at row 10
+  BattleProjection projection = makeProjection(20);
+  BattlePathCache cache;
+  BattleGridArea goal = BattleGridArea::around(10, 15, 1).expanded(1);
+  std::vector<BattleVec2> path = rowPath(projection, 2, 2, 15);
+  path.push_back(cellCentre(projection, 10, 15));
+  cache.store(1, 1, false, kRange, 0, path[0], path, projection, goal);
+
+  // Act: the same cell between the path and the goal is first blocked,
+  // then opened
+  cache.invalidate(BattleGridArea::around(6, 8, 1), true, 0, 1);
+  size_t afterBlocking = cache.size();
+  cache.invalidate(BattleGridArea::around(6, 8, 1), false, 1, 2);
+
+  // Assert: blocking off the path keeps the route, opening may shorten it
+  EXPECT_EQ(afterBlocking, 1u);
+  EXPECT_EQ(cache.size(), 0u);
+}
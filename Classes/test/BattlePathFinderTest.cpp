@@ -0,0 +1,332 @@
+#include <gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "Battle/BattlePathFinder.h"
+#include "test/BattleTestUtils.h"
+
+namespace {
+// Switches the process-wide algorithm for one test and restores A* after
+class ScopedAlgorithm {
+ public:
+  explicit ScopedAlgorithm(BattlePathFinder::Algorithm algorithm) {
+    BattlePathFinder::setAlgorithm(algorithm);
+  }
+  ~ScopedAlgorithm() {
+    BattlePathFinder::setAlgorithm(BattlePathFinder::Algorithm::ASTAR);
+  }
+};
+
+BattleReal pathLength(const BattleVec2& start,
+                      const std::vector<BattleVec2>& path) {
+  BattleReal length = 0;
+  BattleVec2 previous = start;
+  for (const BattleVec2& point : path) {
+    length += previous.distance(point);
+    previous = point;
+  }
+  return length;
+}
+}  // namespace
+
+TEST(BattlePathFinderTest, PathDetoursAroundBlockedArea) {
+  // Arrange: a wall across column 10 with a gap at row 18
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  for (int row = 0; row < 18; ++row) {
+    grid.setArea(row, 10, 1, true);
+  }
+  BattleVec2 start = projection.gridToScene(2.5f, 2.5f);
+  BattleVec2 end = projection.gridToScene(2.5f, 17.5f);
+
+  // Act
+  std::vector<BattleVec2> path =
+      BattlePathFinder::findPath(start, end, projection, grid, 4);
+
+  // Assert
+  ASSERT_FALSE(path.empty());
+  bool passedGap = false;
+  for (const BattleVec2& point : path) {
+    BattleReal row, col;
+    ASSERT_TRUE(projection.screenToGrid(point, row, col));
+    EXPECT_TRUE(grid.isWalkable(static_cast<int>(row), static_cast<int>(col)));
+    passedGap = passedGap || row >= 18.0f;
+  }
+  EXPECT_TRUE(passedGap);
+  // Waypoints sit at sub-cell centres, within one sub-cell of the goal
+  EXPECT_LT(path.back().distance(end), projection.gridPixelLength() / 4);
+}
+
+TEST(BattlePathFinderTest, RepeatedSearchesMatchCallbackOverload) {
+  // Arrange
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  grid.setArea(10, 10, 5, true);
+  auto isWalkable = [&grid](int row, int col) {
+    return grid.isWalkable(row, col);
+  };
+  BattleVec2 start = projection.gridToScene(3.0f, 3.0f);
+  BattleVec2 target = projection.gridToScene(10.0f, 10.0f);
+
+  // Act: the second search reuses the arena left behind by the first
+  std::vector<BattleVec2> first =
+      BattlePathFinder::findPath(start, target, projection, grid, 8);
+  std::vector<BattleVec2> second =
+      BattlePathFinder::findPath(start, target, projection, isWalkable, 8);
+
+  // Assert
+  ASSERT_FALSE(first.empty());
+  ASSERT_EQ(first.size(), second.size());
+  for (size_t i = 0; i < first.size(); ++i) {
+    EXPECT_FLOAT_EQ(static_cast<float>(first[i].x),
+                    static_cast<float>(second[i].x));
+    EXPECT_FLOAT_EQ(static_cast<float>(first[i].y),
+                    static_cast<float>(second[i].y));
+  }
+}
+
+TEST(BattlePathFinderTest, EnclosedTargetReturnsEmpty) {
+  // Arrange: the whole map except the start area is blocked
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  grid.setArea(10, 10, 20, true);
+  grid.setArea(1, 1, 2, false);
+  BattleVec2 start = projection.gridToScene(1.0f, 1.0f);
+  BattleVec2 end = projection.gridToScene(15.0f, 15.0f);
+
+  // Act
+  std::vector<BattleVec2> path =
+      BattlePathFinder::findPath(start, end, projection, grid, 2);
+
+  // Assert
+  EXPECT_TRUE(path.empty());
+}
+
+TEST(BattlePathFinderTest, JumpPointSearchWalksEverySubCell) {
+  // Arrange: the same wall with a gap as PathDetoursAroundBlockedArea
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  for (int row = 0; row < 18; ++row) {
+    grid.setArea(row, 10, 1, true);
+  }
+  BattleVec2 start = projection.gridToScene(2.5f, 2.5f);
+  BattleVec2 end = projection.gridToScene(2.5f, 17.5f);
+  ScopedAlgorithm jps(BattlePathFinder::Algorithm::JPS);
+
+  // Act
+  std::vector<BattleVec2> path =
+      BattlePathFinder::findPath(start, end, projection, grid, 4);
+
+  // Assert: jump points are expanded back into adjacent sub-cells
+  ASSERT_FALSE(path.empty());
+  BattleReal previousRow, previousCol;
+  ASSERT_TRUE(projection.screenToGrid(path[0], previousRow, previousCol));
+  for (const BattleVec2& point : path) {
+    BattleReal row, col;
+    ASSERT_TRUE(projection.screenToGrid(point, row, col));
+    EXPECT_TRUE(grid.isWalkable(static_cast<int>(row), static_cast<int>(col)));
+    EXPECT_LE(std::abs(static_cast<float>(row - previousRow)), 0.26f);
+    EXPECT_LE(std::abs(static_cast<float>(col - previousCol)), 0.26f);
+    previousRow = row;
+    previousCol = col;
+  }
+  EXPECT_LT(path.back().distance(end), projection.gridPixelLength() / 4);
+}
+
+TEST(BattlePathFinderTest, JumpPointSearchExpandsFewerNodes) {
+  // Arrange: scattered buildings between the start and a target building
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  for (int i = 0; i < 4; ++i) {
+    grid.setArea(5 + i * 3, 6 + (i % 2) * 4, 2, true);
+  }
+  grid.setArea(16, 16, 3, true);
+  BattleVec2 start = projection.gridToScene(1.0f, 1.0f);
+  BattleVec2 target = projection.gridToScene(16.0f, 16.0f);
+
+  // Act
+  std::vector<BattleVec2> astarPath =
+      BattlePathFinder::findPath(start, target, projection, grid, 8);
+  int astarExpanded = BattlePathFinder::getLastExpandedCount();
+  std::vector<BattleVec2> jpsPath;
+  int jpsExpanded = 0;
+  {
+    ScopedAlgorithm jps(BattlePathFinder::Algorithm::JPS);
+    jpsPath = BattlePathFinder::findPath(start, target, projection, grid, 8);
+    jpsExpanded = BattlePathFinder::getLastExpandedCount();
+  }
+
+  // Assert: both reach the building along paths of similar length
+  ASSERT_FALSE(astarPath.empty());
+  ASSERT_FALSE(jpsPath.empty());
+  EXPECT_LT(jpsExpanded, astarExpanded);
+  const BattleReal subCell = projection.gridPixelLength() / 8;
+  EXPECT_NEAR(static_cast<float>(pathLength(start, jpsPath)),
+              static_cast<float>(pathLength(start, astarPath)),
+              static_cast<float>(subCell * 4));
+}
+
+TEST(BattlePathFinderTest, JumpPointSearchEnclosedTargetReturnsEmpty) {
+  // Arrange
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  grid.setArea(10, 10, 20, true);
+  grid.setArea(1, 1, 2, false);
+  BattleVec2 start = projection.gridToScene(1.0f, 1.0f);
+  BattleVec2 end = projection.gridToScene(15.0f, 15.0f);
+  ScopedAlgorithm jps(BattlePathFinder::Algorithm::JPS);
+
+  // Act
+  std::vector<BattleVec2> path =
+      BattlePathFinder::findPath(start, end, projection, grid, 2);
+
+  // Assert
+  EXPECT_TRUE(path.empty());
+}
+
+TEST(BattlePathFinderTest, WallOverlayMakesWallsWalkable) {
+  // Arrange: a full wall across column 10 blocks the map, the overlay
+  // marks the wall cells
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  BattleGrid walls(projection.gridSize);
+  for (int row = 0; row < projection.gridSize; ++row) {
+    grid.setArea(row, 10, 1, true);
+    walls.setArea(row, 10, 1, true);
+  }
+  BattleVec2 start = projection.gridToScene(5.5f, 2.5f);
+  BattleVec2 end = projection.gridToScene(5.5f, 17.5f);
+
+  // Act
+  std::vector<BattleVec2> blocked =
+      BattlePathFinder::findPath(start, end, projection, grid, 4);
+  std::vector<BattleVec2> passed = BattlePathFinder::findPath(
+      start, end, projection, BattleGridView(grid, &walls), 4);
+
+  // Assert
+  EXPECT_TRUE(blocked.empty());
+  ASSERT_FALSE(passed.empty());
+  EXPECT_TRUE(BattleGridView(grid, &walls).isWalkable(5, 10));
+  EXPECT_FALSE(BattleGridView(grid).isWalkable(5, 10));
+}
+
+TEST(BattlePathFinderTest, GridWiderThanOneWord) {
+  // Arrange: 70 columns need two 64-bit words per row; the wall sits in
+  // the second word
+  BattleProjection projection = makeProjection(20);
+  projection.gridSize = 70;
+  BattleGrid grid(projection.gridSize);
+  for (int row = 0; row < 68; ++row) {
+    grid.setArea(row, 66, 1, true);
+  }
+  BattleVec2 start = projection.gridToScene(2.5f, 60.5f);
+  BattleVec2 end = projection.gridToScene(2.5f, 68.5f);
+
+  // Act
+  std::vector<BattleVec2> path =
+      BattlePathFinder::findPath(start, end, projection, grid, 1);
+
+  // Assert
+  EXPECT_EQ(grid.getWordsPerRow(), 2);
+  EXPECT_FALSE(grid.isWalkable(10, 66));
+  EXPECT_TRUE(grid.isWalkable(10, 65));
+  ASSERT_FALSE(path.empty());
+  bool passedGap = false;
+  for (const BattleVec2& point : path) {
+    BattleReal row, col;
+    ASSERT_TRUE(projection.screenToGrid(point, row, col));
+    EXPECT_TRUE(grid.isWalkable(static_cast<int>(row), static_cast<int>(col)));
+    passedGap = passedGap || row >= 68.0f;
+  }
+  EXPECT_TRUE(passedGap);
+}
+
+TEST(BattlePathFinderTest, BreachPathPicksCheapestWall) {
+  // Arrange: a ring of walls around (10, 10); every wall is expensive
+  // except one on the far side
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  BattleGrid walls(projection.gridSize);
+  std::vector<int> penalty(projection.gridSize * projection.gridSize, 0);
+  for (int i = 6; i <= 14; ++i) {
+    for (int cell : {6 * 20 + i, 14 * 20 + i, i * 20 + 6, i * 20 + 14}) {
+      grid.setArea(cell / 20, cell % 20, 1, true);
+      walls.setArea(cell / 20, cell % 20, 1, true);
+      penalty[cell] = 1000;
+    }
+  }
+  penalty[10 * 20 + 14] = 20;
+  BattleVec2 start = projection.gridToScene(10.5f, 2.5f);
+  BattleVec2 end = projection.gridToScene(10.5f, 10.5f);
+
+  // Act
+  int firstWall = -1;
+  std::vector<BattleVec2> path = BattlePathFinder::findBreachPath(
+      start, end, projection, grid, walls, penalty, 2, firstWall);
+  std::vector<BattleVec2> blocked =
+      BattlePathFinder::findPath(start, end, projection, grid, 2);
+
+  // Assert: walking around to the weak wall beats breaking the near one
+  EXPECT_TRUE(blocked.empty());
+  ASSERT_FALSE(path.empty());
+  EXPECT_EQ(firstWall, 10 * 20 + 14);
+}
+
+TEST(BattlePathFinderTest, BreachPathWithoutWallsMatchesFindPath) {
+  // Arrange
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  BattleGrid walls(projection.gridSize);
+  grid.setArea(10, 10, 5, true);
+  std::vector<int> penalty(projection.gridSize * projection.gridSize, 0);
+  BattleVec2 start = projection.gridToScene(3.0f, 3.0f);
+  BattleVec2 end = projection.gridToScene(16.0f, 16.0f);
+
+  // Act
+  int firstWall = 0;
+  std::vector<BattleVec2> breach = BattlePathFinder::findBreachPath(
+      start, end, projection, grid, walls, penalty, 2, firstWall);
+  std::vector<BattleVec2> plain =
+      BattlePathFinder::findPath(start, end, projection, grid, 2);
+
+  // Assert
+  EXPECT_EQ(firstWall, -1);
+  ASSERT_EQ(breach.size(), plain.size());
+  for (size_t i = 0; i < plain.size(); ++i) {
+    EXPECT_EQ(breach[i].x, plain[i].x);
+    EXPECT_EQ(breach[i].y, plain[i].y);
+  }
+}
+
+TEST(BattlePathFinderTest, BreachPathSearchesWholeLargeMap) {
+  // Arrange: a 120x120 map split by a solid line open only at its bottom
+  // end; the walled target sits across it from the start, so the search
+  // floods most of the near half before turning the corner
+  BattleProjection projection = makeProjection(120);
+  BattleGrid grid(projection.gridSize);
+  BattleGrid walls(projection.gridSize);
+  std::vector<int> penalty(projection.gridSize * projection.gridSize, 0);
+  for (int row = 0; row < 119; ++row) {
+    grid.setArea(row, 60, 1, true);
+  }
+  for (int i = 6; i <= 14; ++i) {
+    for (int cell : {6 * 120 + 94 + i, 14 * 120 + 94 + i, i * 120 + 100,
+                     i * 120 + 108}) {
+      grid.setArea(cell / 120, cell % 120, 1, true);
+      walls.setArea(cell / 120, cell % 120, 1, true);
+      penalty[cell] = 20;
+    }
+  }
+  BattleVec2 start = projection.gridToScene(10.5f, 10.5f);
+  BattleVec2 end = projection.gridToScene(10.5f, 104.5f);
+
+  // Act
+  int firstWall = -1;
+  std::vector<BattleVec2> path = BattlePathFinder::findBreachPath(
+      start, end, projection, grid, walls, penalty, 2, firstWall);
+
+  // Assert
+  ASSERT_FALSE(path.empty());
+  EXPECT_GE(firstWall, 0);
+}
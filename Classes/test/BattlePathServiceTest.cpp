@@ -0,0 +1,194 @@
+#include <gtest.h>
+
+#include <vector>
+
+#include "Battle/BattlePathService.h"
+#include "Battle/BattleWorld.h"
+#include "test/BattleTestUtils.h"
+
+namespace {
+BattlePathRequest makeRequest(const BattleProjection& projection, int soldier,
+                              int target, BattleReal startRow,
+                              BattleReal priority) {
+  BattlePathRequest request;
+  request.soldier = BattleHandle::make(soldier, 0);
+  request.target = target;
+  request.start = projection.gridToScene(startRow, 2.5f);
+  request.targetRow = 9;
+  request.targetCol = 15;
+  request.targetSize = 3;
+  request.attackRange = 40;
+  request.priority = priority;
+  return request;
+}
+
+BattleWorld makeWorld() {
+  BattleProjection projection = makeProjection();
+  BattleWorld world(projection);
+
+  BattleBuildingStats stats =
+      makeBuildingStats(BuildingType::RESOURCE, 300.0f);
+  world.addBuilding("GoldMine", 1, stats, 20, 20);
+  world.addBuilding("GoldMine", 1, stats, 30, 12);
+
+  BattleSoldierStats soldier = makeSoldierStats(100.0f, 50.0f, 100.0f);
+  for (int i = 0; i < 6; ++i) {
+    world.addSoldier(SoldierType::BARBARIAN, 1, soldier,
+                     projection.gridToScene(4.0f + i * 6, 4.0f));
+  }
+  return world;
+}
+}  // namespace
+
+TEST(BattlePathServiceTest, BudgetTakesClosestRequestsFirst) {
+  // Arrange
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  BattleGrid walls(projection.gridSize);
+  grid.setArea(9, 15, 3, true);
+  BattlePathService service(0, 4);
+  service.setBudget(2);
+  service.submit(makeRequest(projection, 0, 1, 2.5f, 30));
+  service.submit(makeRequest(projection, 1, 1, 8.5f, 10));
+  service.submit(makeRequest(projection, 2, 1, 15.5f, 20));
+
+  // Act
+  std::vector<BattlePathResult> first;
+  service.dispatch(grid, walls, projection);
+  service.collect(first);
+
+  // Assert
+  ASSERT_EQ(first.size(), 2u);
+  EXPECT_EQ(first[0].request.soldier.index(), 1);
+  EXPECT_EQ(first[1].request.soldier.index(), 2);
+  EXPECT_FALSE(first[0].path.empty());
+  EXPECT_FALSE(first[1].path.empty());
+  EXPECT_EQ(service.getPendingCount(), 1u);
+  EXPECT_EQ(service.getSnapshotVersion(), grid.getVersion());
+
+  std::vector<BattlePathResult> second;
+  service.dispatch(grid, walls, projection);
+  service.collect(second);
+  ASSERT_EQ(second.size(), 1u);
+  EXPECT_EQ(second[0].request.soldier.index(), 0);
+}
+
+TEST(BattlePathServiceTest, NewRequestReplacesPendingOne) {
+  // Arrange
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  BattleGrid walls(projection.gridSize);
+  BattlePathService service(0, 4);
+  service.submit(makeRequest(projection, 3, 1, 2.5f, 10));
+
+  // Act
+  service.submit(makeRequest(projection, 3, 2, 6.5f, 10));
+
+  // Assert
+  EXPECT_EQ(service.getPendingCount(), 1u);
+  std::vector<BattlePathResult> results;
+  service.dispatch(grid, walls, projection);
+  service.collect(results);
+  ASSERT_EQ(results.size(), 1u);
+  EXPECT_EQ(results[0].request.target, 2);
+}
+
+TEST(BattlePathServiceTest, WorkerThreadsMatchInlineResults) {
+  // Arrange: two targets, so the batch splits into two flow field jobs
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  BattleGrid walls(projection.gridSize);
+  for (int row = 0; row < 16; ++row) {
+    grid.setArea(row, 8, 1, true);
+  }
+  BattlePathService direct(0, 4);
+  BattlePathService threaded(2, 4);
+  for (int i = 0; i < 8; ++i) {
+    BattlePathRequest request =
+        makeRequest(projection, i, i % 2, 1.5f + i * 2, i);
+    if (i % 2) {
+      request.targetRow = 3;
+      request.targetCol = 17;
+      request.targetSize = 1;
+    }
+    direct.submit(request);
+    threaded.submit(request);
+  }
+
+  // Act
+  std::vector<BattlePathResult> expected;
+  std::vector<BattlePathResult> actual;
+  direct.dispatch(grid, walls, projection);
+  direct.collect(expected);
+  threaded.dispatch(grid, walls, projection);
+  threaded.collect(actual);
+
+  // Assert
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(actual[i].request.soldier, expected[i].request.soldier);
+    ASSERT_EQ(actual[i].path.size(), expected[i].path.size());
+    for (size_t j = 0; j < expected[i].path.size(); ++j) {
+      EXPECT_EQ(actual[i].path[j].x, expected[i].path[j].x);
+      EXPECT_EQ(actual[i].path[j].y, expected[i].path[j].y);
+    }
+  }
+}
+
+TEST(BattlePathServiceTest, AsyncWorldIsIndependentOfThreadCount) {
+  // Arrange
+  BattleWorld inlineWorld = makeWorld();
+  BattleWorld threadedWorld = makeWorld();
+  inlineWorld.enableAsyncPathfinding(0, 2);
+  threadedWorld.enableAsyncPathfinding(2, 2);
+
+  // Act
+  runFor(inlineWorld, 40.0f);
+  runFor(threadedWorld, 40.0f);
+
+  // Assert
+  for (const BattleBuilding& building : inlineWorld.getBuildings()) {
+    EXPECT_FALSE(building.isAlive());
+  }
+  const BattleSoldierArray& expected = inlineWorld.getSoldiers();
+  const BattleSoldierArray& actual = threadedWorld.getSoldiers();
+  ASSERT_EQ(actual.size(), expected.size());
+  for (int i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(actual.position(i).x, expected.position(i).x);
+    EXPECT_EQ(actual.position(i).y, expected.position(i).y);
+  }
+}
+
+TEST(BattlePathServiceTest, SoldiersHoldPositionWhilePathIsPending) {
+  // Arrange
+  BattleWorld world = makeWorld();
+  world.enableAsyncPathfinding(0, 1);
+  const BattleSoldierArray& soldiers = world.getSoldiers();
+  std::vector<BattleVec2> start;
+  for (int i = 0; i < soldiers.size(); ++i) {
+    start.push_back(soldiers.position(i));
+  }
+  const float dt = 1.0f / 60.0f;
+
+  // Act
+  world.update(dt);
+  int movedAfterSubmit = 0;
+  for (int i = 0; i < soldiers.size(); ++i) {
+    if (soldiers.position(i).x != start[i].x ||
+        soldiers.position(i).y != start[i].y) {
+      ++movedAfterSubmit;
+    }
+  }
+  world.update(dt);
+  int movedAfterFirstResult = 0;
+  for (int i = 0; i < soldiers.size(); ++i) {
+    if (soldiers.position(i).x != start[i].x ||
+        soldiers.position(i).y != start[i].y) {
+      ++movedAfterFirstResult;
+    }
+  }
+
+  // Assert
+  EXPECT_EQ(movedAfterSubmit, 0);
+  EXPECT_EQ(movedAfterFirstResult, 1);
+}
@@ -0,0 +1,136 @@
+#include <gtest.h>
+
+#include <vector>
+
+#include "Battle/BattleFlowField.h"
+#include "Battle/BattlePathSmoother.h"
+#include "test/BattleTestUtils.h"
+
+namespace {
+BattleVec2 at(const BattleProjection& projection, float row, float col) {
+  return projection.gridToScene(row, col);
+}
+}  // namespace
+
+TEST(BattlePathSmootherTest, OpenGroundKeepsOnlyTheEndPoint) {
+  // Arrange
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  std::vector<BattleVec2> path;
+  for (int i = 1; i <= 12; ++i) {
+    path.push_back(at(projection, 2.5f + i * 0.5f, 2.5f + i * 0.25f));
+  }
+  BattleVec2 end = path.back();
+
+  // Act
+  BattlePathSmoother::smooth(at(projection, 2.5f, 2.5f), path, projection,
+                             BattleGridView(grid));
+
+  // Assert
+  ASSERT_EQ(path.size(), 1u);
+  EXPECT_EQ(path[0].x, end.x);
+  EXPECT_EQ(path[0].y, end.y);
+}
+
+TEST(BattlePathSmootherTest, PathAroundBlockKeepsTheCorner) {
+  // Arrange: an L-shaped path around the block covering rows/cols 4-7
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  grid.setArea(6, 6, 4, true);
+  std::vector<BattleVec2> path;
+  for (int row = 4; row <= 9; ++row) {
+    path.push_back(at(projection, row + 0.5f, 2.5f));
+  }
+  for (int col = 3; col <= 11; ++col) {
+    path.push_back(at(projection, 9.5f, col + 0.5f));
+  }
+
+  // Act
+  BattlePathSmoother::smooth(at(projection, 3.5f, 2.5f), path, projection,
+                             BattleGridView(grid));
+
+  // Assert: every kept segment stays off the block
+  ASSERT_GE(path.size(), 2u);
+  EXPECT_LT(path.size(), 4u);
+  BattleVec2 from = at(projection, 3.5f, 2.5f);
+  for (const BattleVec2& point : path) {
+    EXPECT_TRUE(BattlePathSmoother::hasLineOfSight(from, point, projection,
+                                                   BattleGridView(grid)));
+    from = point;
+  }
+}
+
+TEST(BattlePathSmootherTest, TouchingABlockedCornerHasNoLineOfSight) {
+  // Arrange
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  grid.setArea(5, 6, 1, true);
+
+  // Act: the diagonal passes exactly through the corner of cell (5, 6)
+  bool touching = BattlePathSmoother::hasLineOfSight(
+      at(projection, 4.5f, 4.5f), at(projection, 7.5f, 7.5f), projection,
+      BattleGridView(grid));
+  bool clear = BattlePathSmoother::hasLineOfSight(
+      at(projection, 4.5f, 4.5f), at(projection, 4.5f, 9.5f), projection,
+      BattleGridView(grid));
+
+  // Assert
+  EXPECT_FALSE(touching);
+  EXPECT_TRUE(clear);
+}
+
+TEST(BattlePathSmootherTest, WallOverlayOpensTheLine) {
+  // Arrange
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  BattleGrid walls(projection.gridSize);
+  grid.setArea(8, 10, 1, true);
+  walls.setArea(8, 10, 1, true);
+  BattleVec2 from = at(projection, 8.5f, 2.5f);
+  BattleVec2 to = at(projection, 8.5f, 17.5f);
+
+  // Act & Assert
+  EXPECT_FALSE(BattlePathSmoother::hasLineOfSight(from, to, projection,
+                                                  BattleGridView(grid)));
+  EXPECT_TRUE(BattlePathSmoother::hasLineOfSight(
+      from, to, projection, BattleGridView(grid, &walls)));
+}
+
+TEST(BattlePathSmootherTest, FlowFieldTraceShrinksToCorners) {
+  // Arrange: a wall across most of the map forces one detour
+  BattleProjection projection = makeProjection(20);
+  BattleGrid grid(projection.gridSize);
+  for (int row = 0; row < 16; ++row) {
+    grid.setArea(row, 10, 1, true);
+  }
+  BattleFlowField field;
+  ASSERT_TRUE(field.build(at(projection, 3.0f, 16.0f), projection, grid, 8));
+  BattleVec2 start = at(projection, 3.0f, 3.0f);
+  std::vector<BattleVec2> traced = field.tracePath(start, projection);
+  std::vector<BattleVec2> path = traced;
+
+  // Act
+  BattlePathSmoother::smooth(start, path, projection, BattleGridView(grid));
+
+  // Assert: kept points come from the trace in order; a segment without a
+  // clear line (the trace cuts diagonally past the wall's corner) is one of
+  // the trace's own steps
+  ASSERT_FALSE(path.empty());
+  EXPECT_LE(path.size() * 10, traced.size());
+  size_t previous = 0;
+  BattleVec2 from = start;
+  for (const BattleVec2& point : path) {
+    size_t index = previous;
+    while (index < traced.size() && (traced[index].x != point.x ||
+                                     traced[index].y != point.y)) {
+      ++index;
+    }
+    ASSERT_LT(index, traced.size());
+    if (!BattlePathSmoother::hasLineOfSight(from, point, projection,
+                                            BattleGridView(grid))) {
+      EXPECT_EQ(index, previous);
+    }
+    previous = index + 1;
+    from = point;
+  }
+}
@@ -0,0 +1,141 @@
+#include <gtest.h>
+
+#include <atomic>
+#include <vector>
+
+#include "Sim/BattleSimulator.h"
+#include "Sim/SimConfig.h"
+#include "Sim/SimScenario.h"
+#include "Sim/SimThreadPool.h"
+
+namespace {
+const char* kSoldierConfig = R"({
+  "barbarian": {
+    "AttackType": "Any",
+    "SoldierType": "LAND",
+    "1": {"Attack": 40, "Health": 200, "MoveSpeed": 90,
+          "AttackSpeed": 1, "AttackRange": 40}
+  }
+})";
+
+const char* kBuildingConfig = R"({
+  "TownHall": {"type": "TOWN_HALL", "GridSize": 3, "maxLevel": 1,
+               "1": {"health": 300}},
+  "GoldMine": {"type": "RESOURCE", "GridSize": 3, "maxLevel": 2,
+               "1": {"health": 200}, "2": {"health": 260}}
+})";
+
+const char* kLayout = R"({
+  "tips": "test layout",
+  "TownHall": [{"row": 20, "col": 20, "level": 1}],
+  "GoldMine": [{"row": 14, "col": 20, "level": 2}]
+})";
+
+SimConfig makeConfig() {
+  SimConfig config;
+  config.parseSoldierConfig(kSoldierConfig);
+  config.parseBuildingConfig(kBuildingConfig);
+  config.parseSpellConfig("{}");
+  config.setP00(BattleVec2(0, 0));
+  return config;
+}
+}  // namespace
+
+TEST(BattleSimulatorTest, ParsesLayoutAndRecord) {
+  // Arrange
+  std::vector<SimBuildingPlacement> layout;
+  SimRecord record;
+  const char* recordText = R"({"records": [
+    {"type": "troop", "category": "barbarian", "level": 1,
+     "x": 10, "y": 20, "timestamp": 2},
+    {"type": "spell", "category": "Heal", "x": 0, "y": 0,
+     "timestamp": 1, "tick": 5}
+  ], "metadata": {"totalRecords": 2, "duration": 60}})";
+
+  // Act
+  bool layoutOk = SimScenario::parseLayout(kLayout, layout);
+  bool recordOk = SimScenario::parseRecord(recordText, 30, record);
+
+  // Assert
+  ASSERT_TRUE(layoutOk);
+  ASSERT_TRUE(recordOk);
+  EXPECT_EQ(layout.size(), 2u);
+  EXPECT_EQ(record.duration, 60);
+  ASSERT_EQ(record.placements.size(), 2u);
+  EXPECT_EQ(record.placements[0].tick, 5);
+  EXPECT_EQ(record.placements[1].tick, 60);
+  EXPECT_EQ(record.placements[1].category, "barbarian");
+}
+
+TEST(BattleSimulatorTest, ReportsDestroyedBase) {
+  // Arrange
+  SimConfig config = makeConfig();
+  std::vector<SimBuildingPlacement> layout;
+  SimScenario::parseLayout(kLayout, layout);
+  BattleVec2 start = config.getProjection().gridToScene(17, 17);
+  SimRecord record;
+  for (int i = 0; i < 3; ++i) {
+    SimPlacement placement;
+    placement.type = "troop";
+    placement.category = "barbarian";
+    placement.x = static_cast<float>(start.x);
+    placement.y = static_cast<float>(start.y);
+    placement.tick = 0;
+    record.placements.push_back(placement);
+  }
+  BattleSimulator simulator(config);
+
+  // Act
+  SimReport report = simulator.run(layout, record);
+
+  // Assert
+  EXPECT_EQ(report.deployed, 3);
+  EXPECT_EQ(report.result.stars, 3);
+  EXPECT_FLOAT_EQ(report.result.ratio, 1.0f);
+  EXPECT_LT(report.ticks, record.duration * simulator.getTickRate());
+  ASSERT_EQ(report.buildings.size(), 2u);
+  EXPECT_TRUE(report.buildings[0].destroyed);
+  EXPECT_TRUE(report.buildings[1].destroyed);
+  const SimBuildingReport& mine = report.buildings[0].name == "GoldMine"
+                                       ? report.buildings[0]
+                                       : report.buildings[1];
+  EXPECT_FLOAT_EQ(mine.maxHP, 260.0f);
+  EXPECT_FLOAT_EQ(mine.damage, 260.0f);
+}
+
+TEST(BattleSimulatorTest, EmptyRecordEndsImmediately) {
+  // Arrange
+  SimConfig config = makeConfig();
+  std::vector<SimBuildingPlacement> layout;
+  SimScenario::parseLayout(kLayout, layout);
+  BattleSimulator simulator(config);
+
+  // Act
+  SimReport report = simulator.run(layout, SimRecord());
+
+  // Assert
+  EXPECT_EQ(report.ticks, 1);
+  EXPECT_EQ(report.result.stars, 0);
+  EXPECT_FALSE(report.buildings[0].destroyed);
+}
+
+TEST(BattleSimulatorTest, ThreadPoolVisitsEveryIndexOnce) {
+  // Arrange
+  SimThreadPool pool(4);
+  std::vector<std::atomic<int>> visits(1000);
+  for (std::atomic<int>& count : visits) {
+    count = 0;
+  }
+
+  // Act
+  for (int round = 0; round < 3; ++round) {
+    pool.parallelFor(static_cast<int>(visits.size()),
+                     [&](int index) { visits[index]++; });
+  }
+
+  // Assert
+  EXPECT_EQ(pool.getThreadCount(), 4);
+  for (const std::atomic<int>& count : visits) {
+    EXPECT_EQ(count.load(), 3);
+  }
+}
@@ -0,0 +1,87 @@
+#include <gtest.h>
+
+#include "Battle/BattleEntities.h"
+#include "Battle/BattleSoldierArray.h"
+
+namespace {
+BattleSoldierStats makeStats(float moveSpeed) {
+  BattleSoldierStats stats;
+  stats.maxHP = 100.0f;
+  stats.moveSpeed = moveSpeed;
+  return stats;
+}
+}  // namespace
+
+TEST(BattleSoldierArrayTest, AddReturnsSequentialIds) {
+  // Arrange
+  BattleSoldierArray soldiers;
+
+  // Act
+  int first = soldiers.add(SoldierType::BARBARIAN, 1, makeStats(100.0f),
+                           BattleVec2(0, 0));
+  int second = soldiers.add(SoldierType::ARCHER, 2, makeStats(100.0f),
+                            BattleVec2(5, 5));
+
+  // Assert
+  EXPECT_EQ(first, 0);
+  EXPECT_EQ(second, 1);
+  EXPECT_EQ(soldiers.size(), 2);
+  EXPECT_EQ(soldiers.level[1], 2);
+  EXPECT_FLOAT_EQ(static_cast<float>(soldiers.hp[1]), 100.0f);
+  EXPECT_TRUE(soldiers.isAlive(1));
+}
+
+TEST(BattleSoldierArrayTest, MovementDoesNotOvershootTarget) {
+  // Arrange
+  BattleSoldierArray soldiers;
+  soldiers.add(SoldierType::BARBARIAN, 1, makeStats(100.0f), BattleVec2(0, 0));
+  soldiers.moveTargetX[0] = 30.0f;
+  soldiers.moveTargetY[0] = 40.0f;
+  soldiers.moveMask[0] = 1.0f;
+
+  // Act
+  soldiers.integrateMovement(0.25f);
+  BattleVec2 halfway = soldiers.position(0);
+  soldiers.integrateMovement(1.0f);
+
+  // Assert
+  EXPECT_NEAR(static_cast<float>(halfway.distance(BattleVec2(0, 0))), 25.0f,
+              1e-4f);
+  EXPECT_NEAR(static_cast<float>(soldiers.x[0]), 30.0f, 1e-4f);
+  EXPECT_NEAR(static_cast<float>(soldiers.y[0]), 40.0f, 1e-4f);
+}
+
+TEST(BattleSoldierArrayTest, MaskedSoldierStaysPut) {
+  // Arrange
+  BattleSoldierArray soldiers;
+  soldiers.add(SoldierType::BARBARIAN, 1, makeStats(100.0f), BattleVec2(0, 0));
+  soldiers.add(SoldierType::BARBARIAN, 1, makeStats(100.0f),
+               BattleVec2(10, 10));
+  soldiers.setPosition(0, BattleVec2(1, 1));
+  soldiers.moveTargetX[1] = 50.0f;
+  soldiers.moveTargetY[1] = 50.0f;
+
+  // Act
+  soldiers.integrateMovement(1.0f);
+
+  // Assert
+  EXPECT_FLOAT_EQ(static_cast<float>(soldiers.x[0]), 1.0f);
+  EXPECT_FLOAT_EQ(static_cast<float>(soldiers.y[0]), 1.0f);
+  EXPECT_FLOAT_EQ(static_cast<float>(soldiers.x[1]), 10.0f);
+  EXPECT_FLOAT_EQ(static_cast<float>(soldiers.y[1]), 10.0f);
+}
+
+TEST(BattleSoldierArrayTest, CooldownsOnlyTickWhenPositive) {
+  // Arrange
+  BattleSoldierArray soldiers;
+  soldiers.add(SoldierType::BARBARIAN, 1, makeStats(100.0f), BattleVec2(0, 0));
+  soldiers.add(SoldierType::BARBARIAN, 1, makeStats(100.0f), BattleVec2(0, 0));
+  soldiers.cooldown[0] = 1.0f;
+
+  // Act
+  soldiers.tickCooldowns(0.25f);
+
+  // Assert
+  EXPECT_FLOAT_EQ(static_cast<float>(soldiers.cooldown[0]), 0.75f);
+  EXPECT_FLOAT_EQ(static_cast<float>(soldiers.cooldown[1]), 0.0f);
+}
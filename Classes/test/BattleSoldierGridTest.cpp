@@ -0,0 +1,74 @@
+#include <gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "Battle/BattleEntities.h"
+#include "Battle/BattleSoldierGrid.h"
+#include "test/BattleTestUtils.h"
+
+namespace {
+std::vector<int> collectNear(const BattleSoldierGrid& grid,
+                             const BattleVec2& center, BattleReal radius) {
+  std::vector<int> ids;
+  grid.forEachNear(center, radius, [&](int i) { ids.push_back(i); });
+  return ids;
+}
+}  // namespace
+
+TEST(BattleSoldierGridTest, NearbyCellsCoverEverySoldierInRadius) {
+  // Arrange: soldiers scattered over the map and slightly outside it
+  BattleProjection projection = makeProjection();
+  BattleSoldierArray soldiers;
+  std::mt19937 random(7);
+  std::uniform_real_distribution<float> gridPos(-2.0f, 46.0f);
+  for (int i = 0; i < 300; ++i) {
+    soldiers.add(SoldierType::BARBARIAN, 1, BattleSoldierStats(),
+                 projection.gridToScene(gridPos(random), gridPos(random)));
+  }
+  BattleSoldierGrid grid;
+  grid.reset(projection, 200.0f);
+
+  // Act
+  grid.build(soldiers);
+
+  // Assert: every soldier within the radius is visited exactly once
+  for (int query = 0; query < 50; ++query) {
+    BattleVec2 center =
+        projection.gridToScene(gridPos(random), gridPos(random));
+    const BattleReal radius = query % 2 == 0 ? 60.0f : 250.0f;
+    std::vector<int> seen(soldiers.size(), 0);
+    for (int i : collectNear(grid, center, radius)) {
+      seen[i]++;
+    }
+    for (int i = 0; i < soldiers.size(); ++i) {
+      EXPECT_LE(seen[i], 1);
+      if (soldiers.position(i).distance(center) <= radius) {
+        EXPECT_EQ(seen[i], 1);
+      }
+    }
+  }
+}
+
+TEST(BattleSoldierGridTest, SkipsDeadSoldiersAndKeepsIdOrder) {
+  // Arrange: three soldiers in the same cell, the middle one dead
+  BattleProjection projection = makeProjection();
+  BattleSoldierArray soldiers;
+  BattleVec2 position = projection.gridToScene(20, 20);
+  for (int i = 0; i < 3; ++i) {
+    soldiers.add(SoldierType::BARBARIAN, 1, BattleSoldierStats(), position);
+  }
+  soldiers.state[1] = SoldierState::DEAD;
+  BattleSoldierGrid grid;
+  grid.reset(projection, 200.0f);
+
+  // Act
+  grid.build(soldiers);
+  std::vector<int> ids = collectNear(grid, position, 10.0f);
+  soldiers.clear();
+  grid.build(soldiers);
+
+  // Assert
+  EXPECT_EQ(ids, std::vector<int>({0, 2}));
+  EXPECT_TRUE(collectNear(grid, position, 10.0f).empty());
+}
@@ -0,0 +1,55 @@
+#ifndef __BATTLE_TEST_UTILS_H__
+#define __BATTLE_TEST_UTILS_H__
+
+#include "Battle/BattleEntities.h"
+#include "Battle/BattleGrid.h"
+#include "Battle/BattleWorld.h"
+
+// Shared factories for the battle core tests
+
+// Map origin at (0, 0) with the default 40 x 30 grid spacing
+inline BattleProjection makeProjection(int gridSize = 44) {
+  BattleProjection projection;
+  projection.p00 = BattleVec2(0, 0);
+  projection.gridSize = gridSize;
+  return projection;
+}
+
+inline BattleBuildingStats makeBuildingStats(BuildingType type, float maxHP,
+                                             int gridCount = 3) {
+  BattleBuildingStats stats;
+  stats.type = type;
+  stats.gridCount = gridCount;
+  stats.maxHP = maxHP;
+  return stats;
+}
+
+// A 3x3 defense firing once per second, 7 grids (210 px) of range
+inline BattleBuildingStats makeDefenseStats(float maxHP, int damage) {
+  BattleBuildingStats stats = makeBuildingStats(BuildingType::DEFENSE, maxHP);
+  stats.damage = damage;
+  stats.attackSpeed = 1.0f;
+  stats.attackRange = 7.0f;
+  return stats;
+}
+
+// A melee soldier attacking once per second
+inline BattleSoldierStats makeSoldierStats(float maxHP, float attackDamage,
+                                           float moveSpeed) {
+  BattleSoldierStats stats;
+  stats.maxHP = maxHP;
+  stats.attackDamage = attackDamage;
+  stats.attackSpeed = 1.0f;
+  stats.moveSpeed = moveSpeed;
+  stats.attackRange = 40.0f;
+  return stats;
+}
+
+inline void runFor(BattleWorld& world, float seconds) {
+  const float dt = 1.0f / 60.0f;
+  for (float t = 0; t < seconds; t += dt) {
+    world.update(dt);
+  }
+}
+
+#endif  // __BATTLE_TEST_UTILS_H__
@@ -0,0 +1,293 @@
+#include <gtest.h>
+
+#include <vector>
+
+#include "Battle/BattleWorld.h"
+#include "test/BattleTestUtils.h"
+
+namespace {
+const BattleSoldierStats kBarbarian = makeSoldierStats(100.0f, 50.0f, 100.0f);
+}  // namespace
+
+TEST(BattleWorldTest, SoldierDestroysBuildingAndFreesGrid) {
+  // Arrange
+  BattleWorld world(makeProjection());
+  int building = world.addBuilding(
+      "GoldMine", 1, makeBuildingStats(BuildingType::RESOURCE, 100.0f), 20,
+      20);
+  world.addSoldier(SoldierType::BARBARIAN, 1, kBarbarian,
+                   world.getProjection().gridToScene(10, 10));
+  ASSERT_FALSE(world.getGrid().isWalkable(20, 20));
+
+  // Act
+  runFor(world, 30.0f);
+
+  // Assert
+  EXPECT_FALSE(world.getBuildings()[building].isAlive());
+  EXPECT_TRUE(world.getGrid().isWalkable(20, 20));
+  EXPECT_EQ(world.getSoldiers().state[0], SoldierState::IDLE);
+}
+
+TEST(BattleWorldTest, SoldierBreaksWallToReachEnclosedBuilding) {
+  // Arrange: a gold mine inside a closed ring of walls
+  BattleWorld world(makeProjection());
+  int building = world.addBuilding(
+      "GoldMine", 1, makeBuildingStats(BuildingType::RESOURCE, 100.0f), 20,
+      20);
+  BattleBuildingStats wallStats = makeBuildingStats(BuildingType::WALL, 100.0f);
+  wallStats.gridCount = 1;
+  for (int i = 16; i <= 24; ++i) {
+    world.addBuilding("Wall", 1, wallStats, 16, i);
+    world.addBuilding("Wall", 1, wallStats, 24, i);
+    if (i > 16 && i < 24) {
+      world.addBuilding("Wall", 1, wallStats, i, 16);
+      world.addBuilding("Wall", 1, wallStats, i, 24);
+    }
+  }
+  world.addSoldier(SoldierType::BARBARIAN, 1, kBarbarian,
+                   world.getProjection().gridToScene(10, 10));
+
+  // Act
+  runFor(world, 1.0f);
+  int firstTarget = world.getSoldiers().target[0];
+  runFor(world, 40.0f);
+
+  // Assert: the soldier heads for a wall first, then the mine
+  EXPECT_EQ(world.getBuildings()[firstTarget].type, BuildingType::WALL);
+  EXPECT_FALSE(world.getBuildings()[building].isAlive());
+}
+
+TEST(BattleWorldTest, ArcherShootsOverWallsWithoutBreaking) {
+  // Arrange: the same walled mine, attacked from outside the ring
+  BattleWorld world(makeProjection());
+  int building = world.addBuilding(
+      "GoldMine", 1, makeBuildingStats(BuildingType::RESOURCE, 100.0f), 20,
+      20);
+  BattleBuildingStats wallStats = makeBuildingStats(BuildingType::WALL, 100.0f);
+  wallStats.gridCount = 1;
+  for (int i = 16; i <= 24; ++i) {
+    world.addBuilding("Wall", 1, wallStats, 16, i);
+    world.addBuilding("Wall", 1, wallStats, 24, i);
+    if (i > 16 && i < 24) {
+      world.addBuilding("Wall", 1, wallStats, i, 16);
+      world.addBuilding("Wall", 1, wallStats, i, 24);
+    }
+  }
+  BattleSoldierStats archer = kBarbarian;
+  archer.attackRange = 200.0f;
+  world.addSoldier(SoldierType::ARCHER, 1, archer,
+                   world.getProjection().gridToScene(10, 10));
+
+  // Act: stop once the mine falls, the walls are the only targets left
+  for (int tick = 0; tick < 1800 && world.getBuildings()[building].isAlive();
+       ++tick) {
+    world.update(1.0f / 60.0f);
+  }
+
+  // Assert
+  EXPECT_FALSE(world.getBuildings()[building].isAlive());
+  for (const BattleBuilding& wall : world.getBuildings()) {
+    if (wall.type == BuildingType::WALL) {
+      EXPECT_TRUE(wall.isAlive());
+    }
+  }
+}
+
+TEST(BattleWorldTest, SoldierPrefersItsAttackTypeThenFallsBack) {
+  // Arrange: a near gold mine and a farther harmless cannon
+  BattleWorld world(makeProjection());
+  int mine = world.addBuilding(
+      "GoldMine", 1, makeBuildingStats(BuildingType::RESOURCE, 100.0f), 12,
+      12);
+  int cannon = world.addBuilding(
+      "Cannon", 1, makeBuildingStats(BuildingType::DEFENSE, 100.0f), 30, 30);
+  BattleSoldierStats giant = kBarbarian;
+  giant.attackType = AttackType::DEFENSE;
+  world.addSoldier(SoldierType::GIANT, 1, giant,
+                   world.getProjection().gridToScene(10, 10));
+
+  // Act
+  world.update(1.0f / 60.0f);
+  int firstTarget = world.getSoldiers().target[0];
+  runFor(world, 40.0f);
+
+  // Assert: the cannon goes first, then the mine as the fallback
+  EXPECT_EQ(firstTarget, cannon);
+  EXPECT_FALSE(world.getBuildings()[cannon].isAlive());
+  EXPECT_FALSE(world.getBuildings()[mine].isAlive());
+}
+
+TEST(BattleWorldTest, DefenseKillsSoldierInRange) {
+  // Arrange
+  BattleWorld world(makeProjection());
+  int building =
+      world.addBuilding("Cannon", 1, makeDefenseStats(1000.0f, 60), 20, 20);
+  BattleVec2 pos = world.getBuildings()[building].position;
+  world.addSoldier(SoldierType::BARBARIAN, 1, kBarbarian,
+                   BattleVec2(pos.x - 150.0f, pos.y));
+
+  // Act
+  runFor(world, 3.0f);
+
+  // Assert
+  EXPECT_FALSE(world.getSoldiers().isAlive(0));
+  EXPECT_TRUE(world.getBuildings()[building].isAlive());
+  EXPECT_FALSE(world.hasLivingSoldiers());
+}
+
+TEST(BattleWorldTest, DefenseRangeFollowsConfig) {
+  // Arrange: a 7-grid cannon and a 10-grid tower, each with a soldier
+  // standing 250 px away
+  BattleWorld world(makeProjection());
+  BattleBuildingStats tower = makeDefenseStats(1000.0f, 60);
+  tower.attackRange = 10.0f;
+  int cannon =
+      world.addBuilding("Cannon", 1, makeDefenseStats(1000.0f, 60), 10, 10);
+  int archerTower = world.addBuilding("ArcherTower", 1, tower, 30, 30);
+  BattleSoldierStats idle = makeSoldierStats(100.0f, 0.0f, 0.0f);
+  for (int building : {cannon, archerTower}) {
+    BattleVec2 pos = world.getBuildings()[building].position;
+    world.addSoldier(SoldierType::BARBARIAN, 1, idle,
+                     BattleVec2(pos.x - 250.0f, pos.y));
+  }
+
+  // Act
+  runFor(world, 3.0f);
+
+  // Assert: only the tower reaches its soldier
+  EXPECT_TRUE(world.getSoldiers().isAlive(0));
+  EXPECT_FALSE(world.getSoldiers().isAlive(1));
+}
+
+TEST(BattleWorldTest, TrapExplodesOnceWhenSoldierEntersRange) {
+  // Arrange
+  BattleWorld world(makeProjection());
+  BattleBuildingStats bomb = makeBuildingStats(BuildingType::TRAP, 1.0f);
+  bomb.gridCount = 1;
+  bomb.damage = 40;
+  bomb.attackRange = 1.0f;
+  int trap = world.addBuilding("Bomb", 1, bomb, 10, 10);
+  world.addSoldier(SoldierType::BARBARIAN, 1, kBarbarian,
+                   world.getBuildings()[trap].position);
+
+  // Act
+  world.update(0.1f);
+  world.update(0.1f);
+
+  // Assert
+  EXPECT_FALSE(world.getBuildings()[trap].armed);
+  EXPECT_FLOAT_EQ(static_cast<float>(world.getSoldiers().hp[0]), 60.0f);
+}
+
+TEST(BattleWorldTest, LightningDamagesBuildingsInRadius) {
+  // Arrange
+  BattleWorld world(makeProjection());
+  int nearBuilding = world.addBuilding(
+      "GoldMine", 1, makeBuildingStats(BuildingType::RESOURCE, 500.0f), 10,
+      10);
+  int farBuilding = world.addBuilding(
+      "ElixirCollector", 1, makeBuildingStats(BuildingType::RESOURCE, 500.0f),
+      30, 30);
+  BattleSpellStats lightning;
+  lightning.radius = 100.0f;
+  lightning.amount = 200.0f;
+
+  // Act
+  world.castSpell(SpellType::LIGHTNING, lightning,
+                  world.getBuildings()[nearBuilding].position);
+  world.update(0.2f);
+
+  // Assert
+  EXPECT_FLOAT_EQ(static_cast<float>(world.getBuildings()[nearBuilding].hp),
+                  300.0f);
+  EXPECT_FLOAT_EQ(static_cast<float>(world.getBuildings()[farBuilding].hp),
+                  500.0f);
+  EXPECT_FALSE(world.getSpells()[0].active);
+}
+
+TEST(BattleWorldTest, RageBoostsAndRestoresSoldier) {
+  // Arrange
+  BattleWorld world(makeProjection());
+  BattleVec2 pos = world.getProjection().gridToScene(10, 10);
+  world.addSoldier(SoldierType::BARBARIAN, 1, kBarbarian, pos);
+  BattleSpellStats rage;
+  rage.category = SpellCategory::DURATION;
+  rage.duration = 1.0f;
+  rage.radius = 100.0f;
+  rage.ratio = 2.0f;
+
+  // Act
+  world.castSpell(SpellType::RAGE, rage, pos);
+  float boostedDamage =
+      static_cast<float>(world.getSoldiers().attackDamage[0]);
+  runFor(world, 1.5f);
+
+  // Assert
+  EXPECT_FLOAT_EQ(boostedDamage, 100.0f);
+  EXPECT_FLOAT_EQ(static_cast<float>(world.getSoldiers().attackDamage[0]),
+                  50.0f);
+  EXPECT_FLOAT_EQ(static_cast<float>(world.getSoldiers().moveSpeed[0]),
+                  100.0f);
+}
+
+TEST(BattleWorldTest, ResultStarsFollowDestroyRatio) {
+  // Arrange
+  BattleResult result;
+
+  // Act & Assert
+  EXPECT_FALSE(BattleResult::evaluate(0, 0, false, result));
+
+  ASSERT_TRUE(BattleResult::evaluate(4, 4, true, result));
+  EXPECT_EQ(result.stars, 3);
+  ASSERT_TRUE(BattleResult::evaluate(4, 2, true, result));
+  EXPECT_EQ(result.stars, 2);
+  ASSERT_TRUE(BattleResult::evaluate(4, 2, false, result));
+  EXPECT_EQ(result.stars, 1);
+  ASSERT_TRUE(BattleResult::evaluate(4, 1, false, result));
+  EXPECT_EQ(result.stars, 0);
+  EXPECT_FALSE(result.win);
+}
+
+TEST(BattleWorldTest, BrokenWallOffPathShortensCachedRoute) {
+  // Arrange: a wall line between the soldier and the mine, passable only
+  // around its top end
+  BattleWorld world(makeProjection());
+  world.addBuilding("GoldMine", 1,
+                    makeBuildingStats(BuildingType::RESOURCE, 30000.0f), 20,
+                    30);
+  BattleBuildingStats wallStats =
+      makeBuildingStats(BuildingType::WALL, 100.0f, 1);
+  for (int row = 8; row < 44; ++row) {
+    world.addBuilding("Wall", 1, wallStats, row, 20);
+  }
+  const BattleVec2 start = world.getProjection().gridToScene(20, 10);
+  world.addSoldier(SoldierType::BARBARIAN, 1, kBarbarian, start);
+  world.update(1.0f / 60.0f);
+  const std::vector<BattleVec2> detour = world.getSoldiers().path[0];
+  BattleSpellStats lightning;
+  lightning.radius = 60.0f;
+  lightning.amount = 200.0f;
+
+  // Act: break three walls straight between the soldier and the mine, then
+  // send a second soldier from the same spot
+  world.castSpell(SpellType::LIGHTNING, lightning,
+                  world.getProjection().gridToScene(20, 20));
+  world.update(0.2f);
+  world.addSoldier(SoldierType::BARBARIAN, 1, kBarbarian, start);
+  world.update(1.0f / 60.0f);
+
+  // Assert
+  auto length = [&start](const std::vector<BattleVec2>& path) {
+    float total = 0;
+    BattleVec2 from = start;
+    for (const BattleVec2& point : path) {
+      total += static_cast<float>(from.distance(point));
+      from = point;
+    }
+    return total;
+  };
+  ASSERT_FALSE(detour.empty());
+  ASSERT_FALSE(world.getSoldiers().path[1].empty());
+  EXPECT_TRUE(world.getGrid().isWalkable(20, 20));
+  EXPECT_LT(length(world.getSoldiers().path[1]), length(detour) * 0.8f);
+}